@@ -0,0 +1,182 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// Throughput and latency benchmark of the modes of the library.
+//
+// Build and run:
+//    g++ -std=c++14 -O2 bench.cpp -o bench && ./bench > bench.csv
+//
+// Usage: bench [max_size [min_time_ms [filter]]]
+//    max_size:    the largest buffer size in bytes (default: 64 MiB)
+//    min_time_ms: the minimum duration of a single measurement (default: 50)
+//    filter:      measure only the algorithm/mode names that contain this string
+//
+// The output is CSV with a header line so the results of different compilers
+// or CPUs can be compared with diff or a spreadsheet. The buffer sizes are
+// 1, 4, 16, ... bytes (powers of 4) up to max_size. Columns:
+//    algorithm, mode, width, size: the measured case
+//    gb_per_s:       throughput in 10^9 bytes per second
+//    cycles_per_byte: TSC cycles per byte (x86 only, empty elsewhere). The TSC
+//                    runs at a constant rate that can differ from the actual
+//                    clock rate of the core.
+//    ns_per_call:    the latency of a single calculate() call
+//    crc:            the CRC of the buffer (the modes must agree)
+
+// Allowing the use of unsafe functions like sprintf() in Visual C++.
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "parametric_crc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>    // uint64_t
+#include <inttypes.h>  // PRIx64 macro
+#include <string.h>
+#include <chrono>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#  ifdef _MSC_VER
+#    include <intrin.h>
+#  else
+#    include <x86intrin.h>
+#  endif
+#  define BENCH_HAS_TSC 1
+#else
+#  define BENCH_HAS_TSC 0
+#endif
+
+namespace {
+
+struct options {
+	size_t max_size = size_t(64) << 20;
+	double min_time = 0.05;
+	const char* filter = "";
+};
+
+options opts;
+uint8_t* buffer;
+
+uint64_t read_tsc() {
+#if BENCH_HAS_TSC
+	return __rdtsc();
+#else
+	return 0;
+#endif
+}
+
+// Calls calculate() on the first size bytes of the buffer until at least
+// opts.min_time seconds have elapsed, then prints a CSV line.
+template <typename CALCULATE>
+void measure(const char* algorithm, const char* mode, int width, size_t size, const CALCULATE& calculate) {
+	using clock = std::chrono::steady_clock;
+	uint64_t crc = calculate(buffer, size);  // warm-up (tables, caches)
+	uint64_t sink = 0;  // keeps the compiler from optimizing out the calls
+
+	uint64_t calls = 0;
+	double elapsed = 0;
+	uint64_t tsc_start = read_tsc();
+	auto start = clock::now();
+	// the number of calls per clock check grows to keep the overhead low
+	for (uint64_t batch=1; elapsed < opts.min_time; batch*=2) {
+		for (uint64_t i=0; i<batch; i++)
+			sink += calculate(buffer, size);
+		calls += batch;
+		elapsed = std::chrono::duration<double>(clock::now() - start).count();
+	}
+	uint64_t tsc_cycles = read_tsc() - tsc_start;
+	if (sink != crc * calls)
+		fprintf(stderr, "%s::%s: inconsistent results\n", algorithm, mode);
+
+	double bytes = double(size) * double(calls);
+	printf("%s,%s,%d,%" PRIu64 ",%.4f,", algorithm, mode, width, (uint64_t)size,
+		bytes / elapsed / 1e9);
+	if (BENCH_HAS_TSC)
+		printf("%.4f", double(tsc_cycles) / bytes);
+	printf(",%.2f,%0*" PRIx64 "\n", elapsed * 1e9 / double(calls), width / 4, crc);
+	fflush(stdout);
+}
+
+template <typename CRC>
+void measure_mode(const char* algorithm, const char* mode) {
+	char name[0x100];
+	sprintf(name, "%s::%s", algorithm, mode);
+	if (!strstr(name, opts.filter))
+		return;
+	for (size_t size=1; size<=opts.max_size; size*=4) {
+		measure(algorithm, mode, CRC::WIDTH, size, [](const uint8_t* p, size_t n) {
+			return uint64_t(CRC::calculate(p, n));
+		});
+	}
+}
+
+template <typename CRC>
+void measure_ext_mode(const char* algorithm, const char* mode) {
+	char name[0x100];
+	sprintf(name, "%s::%s", algorithm, mode);
+	if (!strstr(name, opts.filter))
+		return;
+	static const typename CRC::table_type table;
+	for (size_t size=1; size<=opts.max_size; size*=4) {
+		measure(algorithm, mode, CRC::WIDTH, size, [](const uint8_t* p, size_t n) {
+			return uint64_t(CRC::calculate(p, n, table));
+		});
+	}
+}
+
+template <typename CRC>
+void measure_algorithm(const char* algorithm) {
+	measure_mode<typename CRC::tableless>(algorithm, "tableless");
+	measure_mode<typename CRC::tableless_fast>(algorithm, "tableless_fast");
+	measure_mode<typename CRC::small_table_based>(algorithm, "small_table_based");
+	measure_mode<typename CRC::table_based>(algorithm, "table_based");
+	measure_ext_mode<typename CRC::ext_small_table_based>(algorithm, "ext_small_table_based");
+	measure_ext_mode<typename CRC::ext_table_based>(algorithm, "ext_table_based");
+	measure_mode<typename CRC::template sliced_table_based<8>>(algorithm, "sliced_table_based<8>");
+	measure_mode<typename CRC::template sliced_table_based<16>>(algorithm, "sliced_table_based<16>");
+	measure_ext_mode<typename CRC::template ext_sliced_table_based<16>>(algorithm, "ext_sliced_table_based<16>");
+	measure_mode<typename CRC::template interleaved_table_based<4>>(algorithm, "interleaved_table_based<4>");
+	measure_mode<typename CRC::pre_reflected_table_based>(algorithm, "pre_reflected_table_based");
+	measure_mode<typename CRC::hw_accelerated>(algorithm, "hw_accelerated");
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	if (argc > 1)
+		opts.max_size = size_t(strtoull(argv[1], nullptr, 0));
+	if (argc > 2)
+		opts.min_time = atof(argv[2]) / 1000;
+	if (argc > 3)
+		opts.filter = argv[3];
+
+	buffer = (uint8_t*)malloc(opts.max_size ? opts.max_size : 1);
+	if (!buffer) {
+		fprintf(stderr, "Failed to allocate %" PRIu64 " bytes.\n", (uint64_t)opts.max_size);
+		return 1;
+	}
+	uint32_t seed = 12345;
+	for (size_t i=0; i<opts.max_size; i++) {
+		seed = seed * 1103515245 + 12345;
+		buffer[i] = uint8_t(seed >> 16);
+	}
+
+	printf("algorithm,mode,width,size,gb_per_s,cycles_per_byte,ns_per_call,crc\n");
+
+	// One reflected and one unreflected algorithm per width plus the
+	// algorithms with CRC instructions (iscsi, iso_hdlc) and one with
+	// REF_IN != REF_REG.
+	measure_algorithm<crc8::smbus>("crc8::smbus");
+	measure_algorithm<crc8::rohc>("crc8::rohc");
+	measure_algorithm<crc16::xmodem>("crc16::xmodem");
+	measure_algorithm<crc16::kermit>("crc16::kermit");
+	measure_algorithm<crc32::iso_hdlc>("crc32::iso_hdlc");
+	measure_algorithm<crc32::iscsi>("crc32::iscsi");
+	measure_algorithm<crc32::bzip2>("crc32::bzip2");
+	measure_algorithm<crc::parametric<32, 0x04c11db7, 0xffffffff, 0xffffffff, true, true, false>>(
+		"crc32::iso_hdlc(ref_reg=false)");
+	measure_algorithm<crc64::xz>("crc64::xz");
+	measure_algorithm<crc64::ecma_182>("crc64::ecma_182");
+
+	free(buffer);
+	return 0;
+}
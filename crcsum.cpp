@@ -0,0 +1,361 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// File checksum utility built on the hw_accelerated mode of the library.
+//
+// Build and run:
+//    g++ -std=c++14 -O2 crcsum.cpp -o crcsum && ./crcsum -a crc32::iscsi FILE...
+// Multithreaded build (enables the -j option):
+//    g++ -std=c++14 -O2 -DPARAMETRIC_CRC_THREADS -pthread crcsum.cpp -o crcsum
+//
+// Usage: crcsum [-a algorithm] [-j threads] [-l] [FILE...]
+//    -a algorithm: the name of the algorithm in the crc8, crc16, crc32 or
+//                  crc64 namespace of the library (default: crc32::iso_hdlc)
+//    -j threads:   the number of threads of parallel_calculate() on mapped
+//                  files, 0 means the number of CPU cores (default: 1)
+//    -l:           lists the names of the algorithms
+//    FILE:         the files to checksum, "-" or no FILE means stdin
+//
+// Every file prints a "<crc> <name>" line. On POSIX systems regular files
+// are mapped into memory and fed into the CRC calculation without copying.
+// The kernel receives sequential access and readahead hints for the mapping.
+// Pipes, special files and the files of other systems are read in chunks.
+
+// Allowing the use of unsafe functions like fopen() in Visual C++.
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "parametric_crc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>    // uint64_t
+#include <inttypes.h>  // PRIx64 macro
+#include <string.h>
+#include <errno.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  define CRCSUM_POSIX 1
+#else
+#  define CRCSUM_POSIX 0
+#endif
+
+namespace {
+
+// The size of the blocks of the read() fallback and the size of the window
+// of the mapping that is passed to a single update() call. The readahead hint
+// of the next window is issued before processing the current one.
+constexpr size_t CHUNK_SIZE = size_t(1) << 20;
+
+struct options {
+	const char* algorithm = "crc32::iso_hdlc";
+	unsigned threads = 1;
+};
+
+options opts;
+
+// A file that is mapped into memory or read in chunks when mapping isn't
+// possible (stdin, pipes, special files, non-POSIX systems).
+class input_file {
+#if CRCSUM_POSIX
+	int _fd = -1;
+	void* _map = nullptr;
+#else
+	FILE* _fp = nullptr;
+#endif
+	const uint8_t* _data = nullptr;
+	size_t _size = 0;
+	bool _mapped = false;
+
+public:
+	input_file() = default;
+	input_file(const input_file&) = delete;
+	input_file& operator=(const input_file&) = delete;
+
+	~input_file() {
+#if CRCSUM_POSIX
+		if (_map)
+			munmap(_map, _size);
+		if (_fd > STDERR_FILENO)
+			close(_fd);
+#else
+		if (_fp && _fp != stdin)
+			fclose(_fp);
+#endif
+	}
+
+	bool open(const char* path) {
+		bool use_stdin = !strcmp(path, "-");
+#if CRCSUM_POSIX
+		_fd = use_stdin ? STDIN_FILENO : ::open(path, O_RDONLY);
+		if (_fd < 0)
+			return false;
+		struct stat st;
+		if (fstat(_fd, &st) == 0 && S_ISREG(st.st_mode) && uint64_t(st.st_size) <= SIZE_MAX) {
+			_size = size_t(st.st_size);
+			_mapped = true;
+			if (_size == 0)
+				return true;
+			_map = mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+			if (_map != MAP_FAILED) {
+				_data = (const uint8_t*)_map;
+				madvise(_map, _size, MADV_SEQUENTIAL);
+				return true;
+			}
+			_map = nullptr;
+			_size = 0;
+			_mapped = false;
+		}
+#  ifdef POSIX_FADV_SEQUENTIAL
+		posix_fadvise(_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#  endif
+		return true;
+#else
+		_fp = use_stdin ? stdin : fopen(path, "rb");
+		return _fp != nullptr;
+#endif
+	}
+
+	// The contents of the file if it is mapped.
+	bool mapped() const { return _mapped; }
+	const uint8_t* data() const { return _data; }
+	size_t size() const { return _size; }
+
+	// Asks the kernel to start reading the given range of the mapping.
+	void will_need(size_t offset, size_t size) const {
+#if CRCSUM_POSIX
+		if (offset >= _size)
+			return;
+		if (size > _size - offset)
+			size = _size - offset;
+		// madvise() requires a page aligned address
+		size_t page_offset = size_t(_data + offset - (const uint8_t*)_map) % size_t(sysconf(_SC_PAGESIZE));
+		madvise((void*)(_data + offset - page_offset), size + page_offset, MADV_WILLNEED);
+#else
+		(void)offset;
+		(void)size;
+#endif
+	}
+
+	// Reads the next chunk of an unmapped file. Returns the number of bytes
+	// read, zero at the end of the file and -1 on error.
+	long long read(uint8_t* buf, size_t size) {
+#if CRCSUM_POSIX
+		for (;;) {
+			ssize_t n = ::read(_fd, buf, size);
+			if (n >= 0 || errno != EINTR)
+				return n;
+		}
+#else
+		size_t n = fread(buf, 1, size, _fp);
+		return n == 0 && ferror(_fp) ? -1 : (long long)n;
+#endif
+	}
+};
+
+template <typename CRC>
+bool checksum(input_file& f, uint64_t& result) {
+	using crc_t = typename CRC::hw_accelerated;
+	if (f.mapped()) {
+#ifdef PARAMETRIC_CRC_THREADS
+		if (opts.threads != 1) {
+			result = crc_t::parallel_calculate(f.data(), f.size(), opts.threads);
+			return true;
+		}
+#endif
+		crc_t crc_obj;
+		f.will_need(0, CHUNK_SIZE);
+		for (size_t pos=0; pos<f.size(); pos+=CHUNK_SIZE) {
+			size_t n = f.size() - pos < CHUNK_SIZE ? f.size() - pos : CHUNK_SIZE;
+			f.will_need(pos + CHUNK_SIZE, CHUNK_SIZE);
+			crc_obj.update(f.data() + pos, n);
+		}
+		result = crc_obj.final();
+		return true;
+	}
+
+	static uint8_t buf[CHUNK_SIZE];
+	crc_t crc_obj;
+	for (;;) {
+		long long n = f.read(buf, sizeof(buf));
+		if (n < 0)
+			return false;
+		if (n == 0)
+			break;
+		crc_obj.update(buf, size_t(n));
+	}
+	result = crc_obj.final();
+	return true;
+}
+
+struct algorithm {
+	const char* name;
+	int width;
+	bool (*checksum)(input_file& f, uint64_t& result);
+};
+
+#define ALGORITHM(name) { #name, name::WIDTH, &checksum<name> }
+
+const algorithm ALGORITHMS[] = {
+	ALGORITHM(crc8::rohc),
+	ALGORITHM(crc8::i_432_1),
+	ALGORITHM(crc8::smbus),
+	ALGORITHM(crc8::tech_3250),
+	ALGORITHM(crc8::gsm_a),
+	ALGORITHM(crc8::mifare_mad),
+	ALGORITHM(crc8::i_code),
+	ALGORITHM(crc8::hitag),
+	ALGORITHM(crc8::sae_j1850),
+	ALGORITHM(crc8::opensafety),
+	ALGORITHM(crc8::autosar),
+	ALGORITHM(crc8::maxim_dow),
+	ALGORITHM(crc8::nrsc_5),
+	ALGORITHM(crc8::darc),
+	ALGORITHM(crc8::gsm_b),
+	ALGORITHM(crc8::wcdma),
+	ALGORITHM(crc8::lte),
+	ALGORITHM(crc8::cdma2000),
+	ALGORITHM(crc8::bluetooth),
+	ALGORITHM(crc8::dvb_s2),
+	ALGORITHM(crc8::crc8),
+	ALGORITHM(crc16::dect_x),
+	ALGORITHM(crc16::dect_r),
+	ALGORITHM(crc16::nrsc_5),
+	ALGORITHM(crc16::dnp),
+	ALGORITHM(crc16::en_13757),
+	ALGORITHM(crc16::kermit),
+	ALGORITHM(crc16::tms37157),
+	ALGORITHM(crc16::riello),
+	ALGORITHM(crc16::a),
+	ALGORITHM(crc16::mcrf4xx),
+	ALGORITHM(crc16::ibm_sdlc),
+	ALGORITHM(crc16::xmodem),
+	ALGORITHM(crc16::gsm),
+	ALGORITHM(crc16::spi_fujitsu),
+	ALGORITHM(crc16::ibm_3740),
+	ALGORITHM(crc16::genibus),
+	ALGORITHM(crc16::profibus),
+	ALGORITHM(crc16::opensafety_a),
+	ALGORITHM(crc16::m17),
+	ALGORITHM(crc16::lj1200),
+	ALGORITHM(crc16::opensafety_b),
+	ALGORITHM(crc16::arc),
+	ALGORITHM(crc16::maxim_dow),
+	ALGORITHM(crc16::modbus),
+	ALGORITHM(crc16::usb),
+	ALGORITHM(crc16::umts),
+	ALGORITHM(crc16::dds_110),
+	ALGORITHM(crc16::cms),
+	ALGORITHM(crc16::t10_dif),
+	ALGORITHM(crc16::teledisk),
+	ALGORITHM(crc16::cdma2000),
+	ALGORITHM(crc16::crc16),
+	ALGORITHM(crc16::bluetooth),
+	ALGORITHM(crc16::ccitt),
+	ALGORITHM(crc16::v41_lsb),
+	ALGORITHM(crc16::v41_msb),
+	ALGORITHM(crc16::zmodem),
+	ALGORITHM(crc16::aug_ccitt),
+	ALGORITHM(crc16::ccitt_false),
+	ALGORITHM(crc16::autosar),
+	ALGORITHM(crc16::darc),
+	ALGORITHM(crc16::b),
+	ALGORITHM(crc16::x25),
+	ALGORITHM(crc32::xfer),
+	ALGORITHM(crc32::jamcrc),
+	ALGORITHM(crc32::iso_hdlc),
+	ALGORITHM(crc32::cksum),
+	ALGORITHM(crc32::mpeg2),
+	ALGORITHM(crc32::bzip2),
+	ALGORITHM(crc32::iscsi),
+	ALGORITHM(crc32::mef),
+	ALGORITHM(crc32::cd_rom_edc),
+	ALGORITHM(crc32::aixm),
+	ALGORITHM(crc32::base91_d),
+	ALGORITHM(crc32::autosar),
+	ALGORITHM(crc32::crc32),
+	ALGORITHM(crc32::pkzip),
+	ALGORITHM(crc32::v42),
+	ALGORITHM(crc32::xz),
+	ALGORITHM(crc32::posix),
+	ALGORITHM(crc32::castagnoli),
+	ALGORITHM(crc32::c),
+	ALGORITHM(crc32::d),
+	ALGORITHM(crc32::q),
+	ALGORITHM(crc64::go_iso),
+	ALGORITHM(crc64::ms),
+	ALGORITHM(crc64::xz),
+	ALGORITHM(crc64::ecma_182),
+	ALGORITHM(crc64::we),
+	ALGORITHM(crc64::redis),
+	ALGORITHM(crc64::crc64),
+};
+
+#undef ALGORITHM
+
+const algorithm* find_algorithm(const char* name) {
+	for (const algorithm& a : ALGORITHMS)
+		if (!strcmp(a.name, name))
+			return &a;
+	return nullptr;
+}
+
+int usage() {
+	fprintf(stderr, "Usage: crcsum [-a algorithm] [-j threads] [-l] [FILE...]\n");
+	return 2;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	int i = 1;
+	for (; i<argc && argv[i][0]=='-' && argv[i][1]; i++) {
+		if (!strcmp(argv[i], "--")) {
+			i++;
+			break;
+		}
+		if (!strcmp(argv[i], "-l")) {
+			for (const algorithm& a : ALGORITHMS)
+				printf("%s\n", a.name);
+			return 0;
+		}
+		if (i+1 == argc)
+			return usage();
+		if (!strcmp(argv[i], "-a"))
+			opts.algorithm = argv[++i];
+		else if (!strcmp(argv[i], "-j"))
+			opts.threads = unsigned(strtoul(argv[++i], nullptr, 10));
+		else
+			return usage();
+	}
+
+	const algorithm* algo = find_algorithm(opts.algorithm);
+	if (!algo) {
+		fprintf(stderr, "Unknown algorithm: %s (use -l to list the algorithms)\n", opts.algorithm);
+		return 2;
+	}
+#ifndef PARAMETRIC_CRC_THREADS
+	if (opts.threads != 1)
+		fprintf(stderr, "Built without PARAMETRIC_CRC_THREADS, -j is ignored.\n");
+#endif
+
+	static const char* const STDIN_ONLY[] = { "-" };
+	const char* const* paths = i < argc ? argv + i : STDIN_ONLY;
+	int num_paths = i < argc ? argc - i : 1;
+
+	int rc = 0;
+	for (int k=0; k<num_paths; k++) {
+		input_file f;
+		uint64_t crc_val;
+		if (!f.open(paths[k]) || !algo->checksum(f, crc_val)) {
+			fprintf(stderr, "crcsum: %s: %s\n", paths[k], strerror(errno));
+			rc = 1;
+			continue;
+		}
+		printf("%0*" PRIx64 "  %s\n", algo->width / 4, crc_val, paths[k]);
+	}
+	return rc;
+}
@@ -21,6 +21,29 @@
 //    crc_obj.update("6789", 4);
 //    printf("CRC-16/XMODEM check=0x%04x\n", crc_obj.final());
 //
+// The CRCs of consecutive chunks of the input can be calculated independently
+// (e.g. on different threads) and combined later in O(log(size)) time:
+//
+//    uint16_t crc_1 = crc16::xmodem::calculate("12345", 5);
+//    uint16_t crc_2 = crc16::xmodem::calculate("6789", 4);
+//    uint16_t crc_val = crc16::xmodem::combine(crc_1, crc_2, 4);
+//
+// The parallel_calculate() methods build on this to process large buffers
+// on multiple threads (see the thread_executor and PARAMETRIC_CRC_THREADS).
+// The crc::pipeline class overlaps the reading of a stream with the CRC
+// calculation on a worker thread.
+//
+// The parameters of crc::dynamic are known only at runtime (e.g. they come
+// from a config file). Its lookup tables are shared through a small cache
+// (define PARAMETRIC_CRC_DYNAMIC to enable it):
+//
+//    crc::dynamic_cfg cfg = { 16, 0x1021, 0x0000, 0x0000, false, false, false };
+//    uint64_t crc_val = crc::dynamic(cfg).calculate("123456789", 9);
+//
+// String literals can be hashed at compile time (e.g. for case labels) with
+// the user-defined literals of crc::literals ("name"_crc32, "name"_crc32c,...)
+// or with crc::calculate_string<CRC>() and PARAMETRIC_CRC_CONSTANT().
+//
 // Modes of operation:
 //
 // - table-driven:           (fast, works without table source code generation)
@@ -28,7 +51,14 @@
 //   - small_table_based     (32  constexpr table entries provided by the library)
 //   - ext_table_based       (256 external table entries provided by the user)
 //   - ext_small_table_based (32  external table entries provided by the user)
+//   - sliced_table_based<N>     (N*256 constexpr table entries provided by the library)
+//   - ext_sliced_table_based<N> (N*256 external table entries provided by the user)
+//   - pre_reflected_table_based          (256 constexpr table entries provided by the library)
+//   - interleaved_table_based<LANES>     (256 constexpr table entries provided by the library)
+//   - ext_interleaved_table_based<LANES> (256 external table entries provided by the user)
 // - tableless (slowest, bit-by-bit processing, requires no memory for a table)
+// - tableless_fast (branchless byte-by-byte processing without a table)
+// - hw_accelerated (CPU instructions with table_based fallback)
 //
 // Description of the modes:
 //
@@ -45,6 +75,40 @@
 //   much less space (1/8th of a normal table) but turns a single lookup into
 //   two lookups and a XOR (still faster than processing the data bit-by-bit and
 //   in case of CRC-8 it eliminates the shift operations from the calculation).
+// - The tableless_fast mode needs no table memory either. It replaces the
+//   8 dependent conditional shifts per byte of the tableless mode with 8
+//   independent masked XORs of constants derived from the polynomial. It is
+//   about 2x (at best ~2.2x) faster than the tableless mode on large buffers
+//   and falls back to the tableless loop on inputs shorter than
+//   TABLELESS_FAST_MIN_SIZE (16) bytes. The tableless mode remains the
+//   smallest code.
+// - The sliced table modes (aka. "slicing-by-N") are the fastest table-driven
+//   modes on large buffers: they process N bytes (N=8 or N=16) per iteration
+//   with N independent table lookups instead of a chain of N dependent ones.
+//   The price is a table that is N times larger than a normal table.
+// - The pre_reflected_table_based mode is table_based with a table that has
+//   the bit reversal of the input bytes folded into it. It makes a difference
+//   only if REF_IN != REF_REG (e.g. when REF_REG is forced to share a table
+//   between reflected and unreflected algorithms because in that case the
+//   other modes have to reverse the bits of every input byte).
+// - The interleaved table modes split the input into LANES (2..4) lanes that
+//   are processed in lockstep with separate CRC registers and merged with
+//   GF(2) multiplications. They hide the latency of the dependent table
+//   lookups of the table_based mode without requiring a larger table, which
+//   makes them a good choice for CPUs without CRC or carry-less multiplication
+//   instructions and without the cache for the sliced tables.
+// - The hw_accelerated mode uses the instructions of the CPU: a folding engine
+//   based on carry-less multiplication (x86 PCLMULQDQ, and AVX-512 VPCLMULQDQ
+//   with large buffers) that works with any CRC
+//   algorithm and the CRC instructions of the CPU that exist only for the
+//   CRC-32C polynomial (x86 SSE4.2 and ARMv8) and for the CRC-32/ISO-HDLC
+//   polynomial (ARMv8). The availability of the x86 instructions is detected
+//   at runtime. In all other cases (including compile time evaluation) the
+//   hw_accelerated mode uses the code of the table_based mode.
+//   The engine is selected by the first runtime update() and cached behind a
+//   function pointer. It can be queried for logging purposes:
+//      crc::engine_name(crc32::iscsi::hw_accelerated::selected_engine())
+//   Define PARAMETRIC_CRC_NO_HW_ACCELERATION to disable it.
 /*
 
 void example() {
@@ -189,6 +253,135 @@ void example_2_lower_level_api() {
 #include <stdint.h>  // not needed if you define uint16_t, uint32_t and uint64_t
 #endif
 
+// Define PARAMETRIC_CRC_TABLE_ALLOCATION to enable crc::create_table() and
+// crc::table_replicas (tables in memory returned by your allocator).
+#ifdef PARAMETRIC_CRC_TABLE_ALLOCATION
+#  include <new>  // placement new
+#endif
+
+// Define PARAMETRIC_CRC_DYNAMIC to enable crc::dynamic (the CRC calculator
+// with runtime parameters) and its table cache.
+#ifdef PARAMETRIC_CRC_DYNAMIC
+#  include <atomic>  // the lock of the table cache
+#endif
+
+// Checks the preconditions of the runtime APIs (e.g. the parameters of
+// crc::dynamic and patch()). Define it before including the header to use
+// your own assert handler. It is assert() if PARAMETRIC_CRC_DYNAMIC or
+// PARAMETRIC_CRC_THREADS is defined (they depend on the standard library
+// anyway) and does nothing otherwise.
+#ifndef PARAMETRIC_CRC_ASSERT
+#  if defined(PARAMETRIC_CRC_DYNAMIC) || defined(PARAMETRIC_CRC_THREADS)
+#    include <assert.h>
+#    define PARAMETRIC_CRC_ASSERT(condition) assert(condition)
+#  else
+#    define PARAMETRIC_CRC_ASSERT(condition) ((void)0)
+#  endif
+#endif
+
+// The hw_accelerated mode has to fall back to constexpr code during compile
+// time evaluation. This requires __builtin_is_constant_evaluated() which is
+// provided by recent compilers (GCC 9+, Clang 9+, MSVC 19.25+) even in C++14
+// mode. The hw_accelerated mode is the same as the table_based mode if this
+// builtin isn't available or if PARAMETRIC_CRC_NO_HW_ACCELERATION is defined.
+#if defined(__has_builtin)
+#  if __has_builtin(__builtin_is_constant_evaluated)
+#    define PARAMETRIC_CRC_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+#elif defined(_MSC_VER) && _MSC_VER >= 1925
+#  define PARAMETRIC_CRC_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#endif
+
+#if defined(PARAMETRIC_CRC_IS_CONSTANT_EVALUATED) && !defined(PARAMETRIC_CRC_NO_HW_ACCELERATION)
+#  if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define PARAMETRIC_CRC_HW_X86
+#  elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_CRC32)
+#    define PARAMETRIC_CRC_HW_ARM64
+#  endif
+#endif
+
+#if defined(PARAMETRIC_CRC_HW_X86)
+#  if defined(_MSC_VER) && !defined(__clang__)
+#    include <intrin.h>
+#    define PARAMETRIC_CRC_TARGET(features)
+#  else
+#    include <immintrin.h>
+#    include <cpuid.h>
+     // Allows the use of instruction set extensions in a function
+     // without compiling the whole program with -msse4.2 and friends.
+#    define PARAMETRIC_CRC_TARGET(features) __attribute__((target(features)))
+#  endif
+#elif defined(PARAMETRIC_CRC_HW_ARM64)
+#  include <arm_acle.h>
+#  include <arm_neon.h>
+#endif
+
+// Define PARAMETRIC_CRC_THREADS to enable crc::thread_executor and the
+// parallel_calculate() overload that runs its tasks on std::threads. It also
+// enables crc::pipeline.
+#ifdef PARAMETRIC_CRC_THREADS
+#  include <thread>
+#  include <mutex>
+#  include <condition_variable>
+#  include <memory>
+#endif
+
+// Define PARAMETRIC_CRC_STATS to count the calls and the processed bytes of
+// every CRC algorithm and mode in thread-local counters (see crc::stats).
+// Define PARAMETRIC_CRC_STATS_TIMING too if you want to measure the time
+// spent in the CRC engines (it adds two clock reads per call). Without these
+// macros the instrumentation compiles to nothing. Compile time evaluation
+// isn't affected: the counters are updated only at runtime.
+#ifdef PARAMETRIC_CRC_STATS
+#  ifndef PARAMETRIC_CRC_IS_CONSTANT_EVALUATED
+#    error "PARAMETRIC_CRC_STATS requires __builtin_is_constant_evaluated()"
+#  endif
+#  ifdef PARAMETRIC_CRC_STATS_TIMING
+#    include <chrono>
+#  endif
+#endif
+
+// The number of lookup tables cached by crc::dynamic.
+#ifndef PARAMETRIC_CRC_DYNAMIC_CACHE_SIZE
+#  define PARAMETRIC_CRC_DYNAMIC_CACHE_SIZE 16
+#endif
+
+// The default value of the REF_REG parameter of crc::parametric and crc::cfg.
+// The library default (REF_REG=REF_IN) avoids the bit reversal of the input
+// bytes. Define it as true (or false) to use a canonical REF_REG for every
+// polynomial so the reflected and unreflected algorithms with the same
+// polynomial share their lookup tables.
+#ifndef PARAMETRIC_CRC_DEFAULT_REF_REG
+#  define PARAMETRIC_CRC_DEFAULT_REF_REG(REF_IN) (REF_IN)
+#endif
+
+// The alignment of the entries of the lookup tables. The default (0) is the
+// natural alignment of the entries. Define it as 64 (the size of a cache
+// line) to make a table_based table of CRC-8 occupy 4 cache lines (instead of
+// 5 when it straddles cache line boundaries) and to keep the tables off the
+// cache lines of frequently written data (false sharing). The static tables
+// get any alignment but the operator new of C++14 doesn't support
+// over-aligned types: allocate the tables with crc::create_table() or with
+// C++17 aligned new in that case.
+#ifndef PARAMETRIC_CRC_TABLE_ALIGNMENT
+#  define PARAMETRIC_CRC_TABLE_ALIGNMENT 0
+#endif
+
+// The minimum buffer size of the 512-bit (AVX-512 VPCLMULQDQ) folding engine
+// of the hw_accelerated mode. The 128-bit engine processes smaller buffers:
+// on many CPUs the 512-bit instructions lower the clock frequency of the core
+// for a while and this pays off only with large enough buffers.
+#ifndef PARAMETRIC_CRC_VPCLMUL_MIN_SIZE
+#  define PARAMETRIC_CRC_VPCLMUL_MIN_SIZE 4096
+#endif
+
+// The minimum number of bytes per task in parallel_calculate(). Smaller
+// buffers are processed serially because the scheduling overhead would
+// exceed the gain.
+#ifndef PARAMETRIC_CRC_PARALLEL_MIN_TASK_SIZE
+#  define PARAMETRIC_CRC_PARALLEL_MIN_TASK_SIZE (256*1024)
+#endif
+
 namespace crc {
 
 	using size_t = decltype(sizeof(0));
@@ -259,7 +452,8 @@ namespace crc {
 // algorithm with REF_IN != REF_REG parameters. In a scenario like that all
 // bytes of the input data are passed through this function. Currently none
 // of the builtin CRC algorithms are declared with REF_IN != REF_REG in the
-// crc8, crc16, crc32 and crc64 namespaces but the user of the library can
+// crc8, crc16, crc32 and crc64 namespaces (unless the default is changed
+// with PARAMETRIC_CRC_DEFAULT_REF_REG) but the user of the library can
 // declare one with crc::parameteric<>.
 
 #ifdef PARAMETRIC_CRC_NO_REVERSE_BITS_LOOKUP_TABLE
@@ -315,6 +509,15 @@ namespace crc {
 	template <typename T>
 	struct conditional_reflect<T, true> { static constexpr T fn(T value) noexcept { return reverse_bits(value); } };
 
+	// Reverses the bits of every byte of v without changing the byte order.
+	template <typename T>
+	constexpr T reverse_bits_of_bytes(T v) noexcept {
+		v = T(((v >> 1) & T(0x5555555555555555)) | ((v & T(0x5555555555555555)) << 1));
+		v = T(((v >> 2) & T(0x3333333333333333)) | ((v & T(0x3333333333333333)) << 2));
+		v = T(((v >> 4) & T(0x0F0F0F0F0F0F0F0F)) | ((v & T(0x0F0F0F0F0F0F0F0F)) << 4));
+		return v;
+	}
+
 /*
 	constexpr uint64 reverse_bytes(uint64 v) noexcept {
 		v = ((v >> 8) & 0x00ff00ff00ff00ff) | ((v & 0x00ff00ff00ff00ff) << 8);
@@ -376,6 +579,59 @@ namespace crc {
 		}
 	};
 
+	// Loads sizeof(T) bytes as a little endian (REF=true) or big endian word.
+	// The recursion unrolls the loop at compile time and the compiler merges
+	// the byte loads into a single word load.
+	template <typename T, bool REF, int I=0, bool END=(I==int(sizeof(T)))>
+	struct word_loader {
+		static constexpr int SHIFT = REF ? 8*I : 8*(int(sizeof(T))-1-I);
+		static constexpr T load(const uint8* p) noexcept {
+			return T(T(p[I]) << SHIFT) | word_loader<T, REF, I+1>::load(p);
+		}
+	};
+
+	template <typename T, bool REF, int I>
+	struct word_loader<T, REF, I, true> {
+		static constexpr T load(const uint8*) noexcept { return 0; }
+	};
+
+	// XORs together the N table lookups of a block of slicing-by-N.
+	// The first sizeof(T) bytes of the block have already been XORed into
+	// the CRC register: x. The rest of the bytes are read from p.
+	template <typename T, bool REF, int N, int I=0>
+	struct sliced_table_lookups {
+		// the position of byte I in x (if I < sizeof(T))
+		static constexpr int SHIFT = I >= int(sizeof(T)) ? 0 : REF ? 8*I : 8*(int(sizeof(T))-1-I);
+		template <typename SLICED_TABLE>
+		static constexpr T lookup(T x, const uint8* p, const SLICED_TABLE& table) noexcept {
+			return table.rows[N-1-I][I < int(sizeof(T)) ? uint8(x >> SHIFT) : p[I]]
+				^ sliced_table_lookups<T, REF, N, I+1>::lookup(x, p, table);
+		}
+	};
+
+	template <typename T, bool REF, int N>
+	struct sliced_table_lookups<T, REF, N, N> {
+		template <typename SLICED_TABLE>
+		static constexpr T lookup(T, const uint8*, const SLICED_TABLE&) noexcept { return 0; }
+	};
+
+	// Feeds the byte at position i of every lane of an interleaved block into
+	// the CRC register of the lane. Unrolled with templates like the above.
+	template <typename T, bool REF, int LANES, size_t LANE_SIZE, int K=0>
+	struct interleaved_lane_updates {
+		template <typename TABLE>
+		static constexpr void update(T* lanes, const uint8* p, const TABLE& table) noexcept {
+			table_based_crc_updater<T, REF>::update(lanes[K], p[K*LANE_SIZE], table);
+			interleaved_lane_updates<T, REF, LANES, LANE_SIZE, K+1>::update(lanes, p, table);
+		}
+	};
+
+	template <typename T, bool REF, int LANES, size_t LANE_SIZE>
+	struct interleaved_lane_updates<T, REF, LANES, LANE_SIZE, LANES> {
+		template <typename TABLE>
+		static constexpr void update(T*, const uint8*, const TABLE&) noexcept {}
+	};
+
 	template <int CRC_SHIFT_REGISTER_BIT_WIDTH, bool REFLECTED_CRC_SHIFT_REGISTER>
 	class core;
 
@@ -417,6 +673,74 @@ namespace crc {
 				bbb_update(poly, crc, *p);
 		}
 
+		// Branchless table-less update: the 8 dependent steps of bbb_update()
+		// are replaced with the XOR of the contributions (k0..k7) of the top 8
+		// bits of the register that can be calculated in parallel. The
+		// contributions are derived from poly on entry (at compile time when
+		// poly is a constant) and kept in registers instead of a table.
+		static constexpr void tableless_fast_update(T poly, T& crc, const uint8* begin, const uint8* end) noexcept {
+			T k[8] = {};
+			for (int j=0; j<8; j++) {
+				k[j] = T(1) << (WIDTH - 8 + j);
+				bbb_update(poly, k[j], 0);
+			}
+			const T k0 = k[0], k1 = k[1], k2 = k[2], k3 = k[3], k4 = k[4], k5 = k[5], k6 = k[6], k7 = k[7];
+			for (auto p=begin; p<end; ++p) {
+				T x = crc ^ T(T(*p) << (WIDTH - 8));
+				unsigned h = unsigned(x >> (WIDTH - 8));
+				T t0 = T(k0 & T(0 - T(h & 1)))        ^ T(k1 & T(0 - T((h >> 1) & 1)));
+				T t1 = T(k2 & T(0 - T((h >> 2) & 1))) ^ T(k3 & T(0 - T((h >> 3) & 1)));
+				T t2 = T(k4 & T(0 - T((h >> 4) & 1))) ^ T(k5 & T(0 - T((h >> 5) & 1)));
+				T t3 = T(k6 & T(0 - T((h >> 6) & 1))) ^ T(k7 & T(0 - T((h >> 7) & 1)));
+				crc = T(x << 8) ^ T(t0 ^ t1) ^ T(t2 ^ t3);
+			}
+		}
+
+		// GF(2) polynomial arithmetic modulo poly. The polynomials are stored
+		// the same way as the contents of the CRC shift register: bit i is the
+		// coefficient of x^i (the x^WIDTH term of poly is implicit).
+
+		// returns a*x mod poly
+		static constexpr T multiply_by_x(T poly, T a) noexcept {
+			return (a & MSB_MASK) ? T((a << 1) ^ poly) : T(a << 1);
+		}
+
+		// returns a*b mod poly
+		// Branchless because the bits of the operands are unpredictable.
+		static constexpr T multiply(T poly, T a, T b) noexcept {
+			T product = 0;
+			for (int i=WIDTH-1; i>=0; i--) {
+				product = T(product << 1) ^ T(poly & T(0 - T(product >> (WIDTH-1))));
+				product ^= T(b & T(0 - T((a >> i) & 1)));
+			}
+			return product;
+		}
+
+		// returns x^(8*n) mod poly in O(log(n)) time
+		static constexpr T x_pow_8n(T poly, size_t n) noexcept {
+			T x_pow_8 = 1;
+			for (int i=0; i<8; i++)
+				x_pow_8 = multiply_by_x(poly, x_pow_8);
+			return pow(poly, x_pow_8, n);
+		}
+
+		// returns a^n mod poly
+		static constexpr T pow(T poly, T a, size_t n) noexcept {
+			T result = 1;
+			for (; n; n>>=1) {
+				if (n & 1)
+					result = multiply(poly, result, a);
+				a = multiply(poly, a, a);
+			}
+			return result;
+		}
+
+		// Has the same effect as feeding n zero bytes into the CRC register
+		// but it runs in O(log(n)) time.
+		static constexpr void zeros_update(T poly, T& crc, size_t n) noexcept {
+			crc = multiply(poly, crc, x_pow_8n(poly, n));
+		}
+
 		// Perform a CRC update using the specified lookup table.
 		// TABLE is an object with support for array subscript and indexes in the
 		// range [0..255]. It will be a normal C array or an object with compatible
@@ -503,6 +827,64 @@ namespace crc {
 			for (uint8 k=1; k<0x10; k++)
 				first_column[k] = table_entry(poly, k<<4, 0);
 		}
+
+		// Interleaved table-driven update: every block of LANES*LANE_SIZE bytes
+		// is split into LANES contiguous lanes that are processed in lockstep
+		// with separate CRC registers. The table lookups of the lanes don't
+		// depend on each other so the CPU can execute them in parallel instead
+		// of waiting for the result of the previous lookup. The lanes (except
+		// the first one) start with a zero register and they are merged at the
+		// end of the block by multiplying the combined register with
+		// lane_shift=x_pow_8n(poly, LANE_SIZE) (see zeros_update()).
+		// The input after the last full block is processed by table_based_update().
+		template <int LANES, size_t LANE_SIZE, typename TABLE>
+		static constexpr void interleaved_table_based_update(T poly, T lane_shift, T& crc,
+				const uint8* begin, const uint8* end, const TABLE& table) noexcept {
+			static_assert(LANES >= 2, "interleaving requires at least two lanes");
+			auto p = begin;
+			for (; size_t(end - p) >= LANES * LANE_SIZE; p += LANES * LANE_SIZE) {
+				T lanes[LANES] = {};
+				lanes[0] = crc;
+				for (size_t i=0; i<LANE_SIZE; i++)
+					interleaved_lane_updates<T, false, LANES, LANE_SIZE>::update(lanes, p + i, table);
+				crc = lanes[0];
+				for (int k=1; k<LANES; k++)
+					crc = multiply(poly, crc, lane_shift) ^ lanes[k];
+			}
+			table_based_update(crc, p, end, table);
+		}
+
+		// Generates the N rows of a "slicing-by-N" lookup table.
+		// rows[0] is a normal lookup table and rows[k][i] is the CRC update
+		// caused by byte i followed by k zero bytes.
+		template <int N>
+		static constexpr void generate_sliced_table(T poly, T rows[][256]) noexcept {
+			generate_table(poly, rows[0]);
+			for (int k=1; k<N; k++) {
+				for (int i=0; i<256; i++) {
+					T entry = rows[k-1][i];
+					table_based_crc_updater<T, false>::update(entry, 0, rows[0]);
+					rows[k][i] = entry;
+				}
+			}
+		}
+
+		// Processes N input bytes per iteration with N independent lookups
+		// into the rows of a slicing-by-N table. The first sizeof(T) bytes of
+		// every block are loaded as a big endian word and XORed into the
+		// register. The rest of the bytes (the last few bytes of the input
+		// that don't make up a whole block) go through the normal bytewise
+		// update that uses rows[0] of the table.
+		template <int N, typename SLICED_TABLE>
+		static constexpr void sliced_table_based_update(T& crc, const uint8* begin, const uint8* end, const SLICED_TABLE& table) noexcept {
+			static_assert(N >= int(sizeof(T)), "slicing-by-N requires N >= sizeof(T)");
+			auto p = begin;
+			for (; end - p >= N; p += N) {
+				T x = crc ^ word_loader<T, false>::load(p);
+				crc = sliced_table_lookups<T, false, N>::lookup(x, p, table);
+			}
+			table_based_update(crc, p, end, table.rows[0]);
+		}
 	};
 
 	// reflected CRC shift register
@@ -537,6 +919,71 @@ namespace crc {
 				bbb_update(ref_poly, crc, *p);
 		}
 
+		// Branchless table-less update (see core<WIDTH,false>::tableless_fast_update).
+		static constexpr void tableless_fast_update(T ref_poly, T& crc, const uint8* begin, const uint8* end) noexcept {
+			T k[8] = {};
+			for (int j=0; j<8; j++) {
+				k[j] = T(1) << j;
+				bbb_update(ref_poly, k[j], 0);
+			}
+			const T k0 = k[0], k1 = k[1], k2 = k[2], k3 = k[3], k4 = k[4], k5 = k[5], k6 = k[6], k7 = k[7];
+			for (auto p=begin; p<end; ++p) {
+				T x = crc ^ *p;
+				T t0 = T(k0 & T(0 - T(x & 1)))        ^ T(k1 & T(0 - T((x >> 1) & 1)));
+				T t1 = T(k2 & T(0 - T((x >> 2) & 1))) ^ T(k3 & T(0 - T((x >> 3) & 1)));
+				T t2 = T(k4 & T(0 - T((x >> 4) & 1))) ^ T(k5 & T(0 - T((x >> 5) & 1)));
+				T t3 = T(k6 & T(0 - T((x >> 6) & 1))) ^ T(k7 & T(0 - T((x >> 7) & 1)));
+				crc = T(x >> 8) ^ T(t0 ^ t1) ^ T(t2 ^ t3);
+			}
+		}
+
+		// GF(2) polynomial arithmetic modulo ref_poly. The polynomials are
+		// stored the same way as the contents of the reflected CRC shift
+		// register: bit (WIDTH-1-i) is the coefficient of x^i.
+
+		static constexpr T MSB_MASK = T(1) << (WIDTH - 1);  // x^0
+
+		// returns a*x mod ref_poly
+		static constexpr T multiply_by_x(T ref_poly, T a) noexcept {
+			return (a & 1) ? T((a >> 1) ^ ref_poly) : T(a >> 1);
+		}
+
+		// returns a*b mod ref_poly
+		// Branchless because the bits of the operands are unpredictable.
+		static constexpr T multiply(T ref_poly, T a, T b) noexcept {
+			T product = 0;
+			for (int i=0; i<WIDTH; i++) {
+				product = T(product >> 1) ^ T(ref_poly & T(0 - T(product & 1)));
+				product ^= T(b & T(0 - T((a >> i) & 1)));
+			}
+			return product;
+		}
+
+		// returns x^(8*n) mod ref_poly in O(log(n)) time
+		static constexpr T x_pow_8n(T ref_poly, size_t n) noexcept {
+			T x_pow_8 = MSB_MASK;
+			for (int i=0; i<8; i++)
+				x_pow_8 = multiply_by_x(ref_poly, x_pow_8);
+			return pow(ref_poly, x_pow_8, n);
+		}
+
+		// returns a^n mod ref_poly
+		static constexpr T pow(T ref_poly, T a, size_t n) noexcept {
+			T result = MSB_MASK;
+			for (; n; n>>=1) {
+				if (n & 1)
+					result = multiply(ref_poly, result, a);
+				a = multiply(ref_poly, a, a);
+			}
+			return result;
+		}
+
+		// Has the same effect as feeding n zero bytes into the CRC register
+		// but it runs in O(log(n)) time.
+		static constexpr void zeros_update(T ref_poly, T& crc, size_t n) noexcept {
+			crc = multiply(ref_poly, crc, x_pow_8n(ref_poly, n));
+		}
+
 		template <typename TABLE>
 		static constexpr void table_based_update(T& crc, const uint8* begin, const uint8* end, const TABLE& table) noexcept {
 			for (auto p = begin; p<end; ++p)
@@ -619,20 +1066,77 @@ namespace crc {
 				// the lower nibble (4 bits) is zero so table_entry() can skip it
 				first_column[k] = table_entry(ref_poly, k<<4, 4);
 		}
+
+		// Same as the unreflected version.
+		template <int LANES, size_t LANE_SIZE, typename TABLE>
+		static constexpr void interleaved_table_based_update(T ref_poly, T lane_shift, T& crc,
+				const uint8* begin, const uint8* end, const TABLE& table) noexcept {
+			static_assert(LANES >= 2, "interleaving requires at least two lanes");
+			auto p = begin;
+			for (; size_t(end - p) >= LANES * LANE_SIZE; p += LANES * LANE_SIZE) {
+				T lanes[LANES] = {};
+				lanes[0] = crc;
+				for (size_t i=0; i<LANE_SIZE; i++)
+					interleaved_lane_updates<T, true, LANES, LANE_SIZE>::update(lanes, p + i, table);
+				crc = lanes[0];
+				for (int k=1; k<LANES; k++)
+					crc = multiply(ref_poly, crc, lane_shift) ^ lanes[k];
+			}
+			table_based_update(crc, p, end, table);
+		}
+
+		template <int N>
+		static constexpr void generate_sliced_table(T ref_poly, T rows[][256]) noexcept {
+			generate_table(ref_poly, rows[0]);
+			for (int k=1; k<N; k++) {
+				for (int i=0; i<256; i++) {
+					T entry = rows[k-1][i];
+					table_based_crc_updater<T, true>::update(entry, 0, rows[0]);
+					rows[k][i] = entry;
+				}
+			}
+		}
+
+		// Same as the unreflected version but the first sizeof(T) bytes of
+		// every block are loaded as a little endian word.
+		template <int N, typename SLICED_TABLE>
+		static constexpr void sliced_table_based_update(T& crc, const uint8* begin, const uint8* end, const SLICED_TABLE& table) noexcept {
+			static_assert(N >= int(sizeof(T)), "slicing-by-N requires N >= sizeof(T)");
+			auto p = begin;
+			for (; end - p >= N; p += N) {
+				T x = crc ^ word_loader<T, true>::load(p);
+				crc = sliced_table_lookups<T, true, N>::lookup(x, p, table);
+			}
+			table_based_update(crc, p, end, table.rows[0]);
+		}
 	};
 
 	enum uninitialized_type { UNINITIALIZED };
 
+	// The alignment of the entries of a table (see PARAMETRIC_CRC_TABLE_ALIGNMENT).
+	template <typename T>
+	struct table_alignment {
+		static constexpr size_t VALUE = PARAMETRIC_CRC_TABLE_ALIGNMENT > alignof(T) ?
+			PARAMETRIC_CRC_TABLE_ALIGNMENT : alignof(T);
+	};
+
 	template <typename T>
 	struct basic_table {
 		constexpr basic_table() noexcept : entries() {}
 		// Unlike the default constexpr constructor this one doesn't call
 		// the constructor of the entries array so there is no zero fill.
 		basic_table(uninitialized_type) noexcept {}
+		// Copies precomputed entries (e.g. the output of table_gen.cpp).
+		constexpr basic_table(const T (&src)[256]) noexcept : entries() {
+			for (int i=0; i<256; i++)
+				entries[i] = src[i];
+		}
 
 		using value_type = T;
+		// the size of the entries without the alignment padding (see table_usage<>)
+		static constexpr size_t PAYLOAD_BYTES = sizeof(T) * 256;
 
-		T entries[256];
+		alignas(table_alignment<T>::VALUE) T entries[256];
 
 		constexpr T operator[](uint8 index) const noexcept {
 			return entries[index];
@@ -646,10 +1150,23 @@ namespace crc {
 		// constructor of the first_row and first_column arrays so there is no
 		// zero fill.
 		basic_small_table(uninitialized_type) noexcept {}
+		// Copies precomputed entries (e.g. the output of table_gen.cpp).
+		constexpr basic_small_table(const T (&src_first_row)[16], const T (&src_first_column)[16]) noexcept
+				: first_row(), first_column() {
+			for (int i=0; i<16; i++) {
+				first_row[i] = src_first_row[i];
+				first_column[i] = src_first_column[i];
+			}
+		}
 
 		using value_type = T;
+		static constexpr size_t PAYLOAD_BYTES = sizeof(T) * 32;
+		// The table fits into a cache line with a smaller alignment (e.g. the
+		// 32 bytes of CRC-8) so it isn't padded to PARAMETRIC_CRC_TABLE_ALIGNMENT.
+		static constexpr size_t ALIGNMENT = table_alignment<T>::VALUE < PAYLOAD_BYTES ?
+			table_alignment<T>::VALUE : PAYLOAD_BYTES;
 
-		T first_row[16];
+		alignas(ALIGNMENT) T first_row[16];
 		T first_column[16];
 
 		constexpr T operator[](uint8 index) const noexcept {
@@ -657,6 +1174,33 @@ namespace crc {
 		}
 	};
 
+	// A "slicing-by-N" table: N rows of 256 entries. rows[0] is identical to
+	// the entries of a basic_table<> so this table can be used with the
+	// bytewise table_based_update() too.
+	template <typename T, int N>
+	struct basic_sliced_table {
+		constexpr basic_sliced_table() noexcept : rows() {}
+		// Unlike the default constexpr constructor this one doesn't call
+		// the constructor of the rows array so there is no zero fill.
+		basic_sliced_table(uninitialized_type) noexcept {}
+		// Copies precomputed entries (e.g. the output of table_gen.cpp).
+		constexpr basic_sliced_table(const T (&src)[N][256]) noexcept : rows() {
+			for (int r=0; r<N; r++)
+				for (int i=0; i<256; i++)
+					rows[r][i] = src[r][i];
+		}
+
+		using value_type = T;
+		static constexpr int NUM_ROWS = N;
+		static constexpr size_t PAYLOAD_BYTES = sizeof(T) * 256 * N;
+
+		alignas(table_alignment<T>::VALUE) T rows[N][256];
+
+		constexpr T operator[](uint8 index) const noexcept {
+			return rows[0][index];
+		}
+	};
+
 	// tbl_cfg is the config parameter for the table template classes below.
 	//
 	// The POLY template parameter is always in unreflected form by convention.
@@ -680,6 +1224,10 @@ namespace crc {
 		// Pass the UNINITIALIZED constant to the constructor if you
 		// want to skip the table generation and do it later manually.
 		table(uninitialized_type) : basic_table<typename TBL_CFG::T>(UNINITIALIZED) {}
+		// Skips the table generation: the entries have to be the output of
+		// generate() (e.g. from table_gen.cpp) otherwise the CRCs are wrong.
+		constexpr table(const typename TBL_CFG::T (&entries)[256]) noexcept
+			: basic_table<typename TBL_CFG::T>(entries) {}
 
 		constexpr table() noexcept {
 			generate();
@@ -696,6 +1244,11 @@ namespace crc {
 		// Pass the UNINITIALIZED constant to the constructor if you
 		// want to skip the table generation and do it later manually.
 		small_table(uninitialized_type) : basic_small_table<typename TBL_CFG::T>(UNINITIALIZED) {}
+		// Skips the table generation: the entries have to be the output of
+		// generate() (e.g. from table_gen.cpp) otherwise the CRCs are wrong.
+		constexpr small_table(const typename TBL_CFG::T (&first_row)[16],
+				const typename TBL_CFG::T (&first_column)[16]) noexcept
+			: basic_small_table<typename TBL_CFG::T>(first_row, first_column) {}
 
 		constexpr small_table() noexcept {
 			generate();
@@ -707,6 +1260,84 @@ namespace crc {
 		}
 	};
 
+	// N is the number of bytes processed per iteration (8 or 16 is a good
+	// choice) and also the number of rows in the table. The size of the table
+	// is N*256*sizeof(T) bytes: 8KB in case of slicing-by-8 with CRC-32.
+	template <typename TBL_CFG, int N>
+	struct sliced_table : public basic_sliced_table<typename TBL_CFG::T, N> {
+		// Pass the UNINITIALIZED constant to the constructor if you
+		// want to skip the table generation and do it later manually.
+		sliced_table(uninitialized_type) : basic_sliced_table<typename TBL_CFG::T, N>(UNINITIALIZED) {}
+		// Skips the table generation: the rows have to be the output of
+		// generate() (e.g. from table_gen.cpp) otherwise the CRCs are wrong.
+		constexpr sliced_table(const typename TBL_CFG::T (&rows)[N][256]) noexcept
+			: basic_sliced_table<typename TBL_CFG::T, N>(rows) {}
+
+		constexpr sliced_table() noexcept {
+			generate();
+		}
+
+		constexpr void generate() noexcept {
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::template generate_sliced_table<N>(
+				TBL_CFG::ACTUAL_POLY, this->rows);
+		}
+	};
+
+	// The table of the pre_reflected_table_based mode. The bit reversal of
+	// the input bytes (REF_IN != REF_REG) can be folded into the table if the
+	// bits in each byte of the CRC register are reversed too: with a table
+	// generated as pre_reflected[i] = reverse_bits_of_bytes(normal[reverse_bits(i)])
+	// the table-driven update of a register that holds
+	// reverse_bits_of_bytes(crc) consumes the input bytes without reversal.
+	template <typename TBL_CFG>
+	struct pre_reflected_table : public basic_table<typename TBL_CFG::T> {
+		// Pass the UNINITIALIZED constant to the constructor if you
+		// want to skip the table generation and do it later manually.
+		pre_reflected_table(uninitialized_type) : basic_table<typename TBL_CFG::T>(UNINITIALIZED) {}
+		// Skips the table generation: the entries have to be the output of
+		// generate() (e.g. from table_gen.cpp) otherwise the CRCs are wrong.
+		constexpr pre_reflected_table(const typename TBL_CFG::T (&entries)[256]) noexcept
+			: basic_table<typename TBL_CFG::T>(entries) {}
+
+		constexpr pre_reflected_table() noexcept {
+			generate();
+		}
+
+		constexpr void generate() noexcept {
+			typename TBL_CFG::T normal[256] = {};
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::generate_table(TBL_CFG::ACTUAL_POLY, normal);
+			for (int i=0; i<256; i++)
+				this->entries[i] = reverse_bits_of_bytes(normal[reverse_bits(uint8(i))]);
+		}
+	};
+
+} // namespace crc
+
+// PARAMETRIC_CRC_EXTERN_TABLES is the name of a header generated by
+// table_gen.cpp. It replaces the constexpr static_table<>::instance of the
+// listed tables with an extern object that is defined in the translation
+// unit that defines PARAMETRIC_CRC_DEFINE_TABLES. The other translation
+// units don't generate these tables at compile time so they compile faster
+// but the modes that use them can't be evaluated at compile time (this
+// includes crc::calculate_string() and the crc::literals of the algorithms
+// whose table_based table is exported). The header is included here because
+// the static_table<> specializations have to precede the first use of the
+// tables (e.g. the crc::literals below).
+#define PARAMETRIC_CRC_EXTERN_STATIC_TABLE(...) \
+	namespace crc { \
+		template <> \
+		struct static_table<__VA_ARGS__> { \
+			static_table() = delete; \
+			static const __VA_ARGS__ instance; \
+		}; \
+	}
+
+#ifdef PARAMETRIC_CRC_EXTERN_TABLES
+#  include PARAMETRIC_CRC_EXTERN_TABLES
+#endif
+
+namespace crc {
+
 	// To be used as the 'UPDATER' template parameter of the 'impl' class.
 	template <typename TBL_CFG>
 	struct updater_tableless {
@@ -719,6 +1350,28 @@ namespace crc {
 		}
 	};
 
+	// The tableless_fast mode processes inputs shorter than this with the
+	// bit-by-bit loop of the tableless mode: deriving the constants from the
+	// polynomial costs more than it saves below roughly 16 bytes (measured
+	// with crc8::autosar, crc32::iscsi and crc64::xz on x86-64 with GCC -O2).
+	static constexpr size_t TABLELESS_FAST_MIN_SIZE = 16;
+
+	// To be used as the 'UPDATER' template parameter of the 'impl' class.
+	template <typename TBL_CFG>
+	struct updater_tableless_fast {
+		using table_type = void;
+	protected:
+		static constexpr void update(
+			typename TBL_CFG::T& crc, const uint8* begin, const uint8* end) noexcept {
+			if (size_t(end - begin) < TABLELESS_FAST_MIN_SIZE)
+				core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::tableless_update(
+					TBL_CFG::ACTUAL_POLY, crc, begin, end);
+			else
+				core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::tableless_fast_update(
+					TBL_CFG::ACTUAL_POLY, crc, begin, end);
+		}
+	};
+
 	// To be used as the 'UPDATER' template parameter of the 'impl' class.
 	template <typename TBL_CFG>
 	struct updater_table_based {
@@ -757,6 +1410,76 @@ namespace crc {
 		}
 	};
 
+	// The number of bytes per lane in a block of the interleaved modes.
+	// The lanes are merged at the end of every block with multiplications
+	// that cost about as much as a few dozen table lookups.
+#ifndef PARAMETRIC_CRC_INTERLEAVED_LANE_SIZE
+#  define PARAMETRIC_CRC_INTERLEAVED_LANE_SIZE 128
+#endif
+
+	template <typename TBL_CFG, int LANES>
+	struct interleaved_table_based_updater {
+		static constexpr size_t LANE_SIZE = PARAMETRIC_CRC_INTERLEAVED_LANE_SIZE;
+		static constexpr typename TBL_CFG::T LANE_SHIFT =
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::x_pow_8n(TBL_CFG::ACTUAL_POLY, LANE_SIZE);
+
+		static constexpr void update(typename TBL_CFG::T& crc,
+			const uint8* begin, const uint8* end, const basic_table<typename TBL_CFG::T>& t) noexcept {
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::template interleaved_table_based_update<LANES, LANE_SIZE>(
+				TBL_CFG::ACTUAL_POLY, LANE_SHIFT, crc, begin, end, t);
+		}
+	};
+
+	// To be used as the 'UPDATER' template parameter of the 'impl' class.
+	template <typename TBL_CFG, int LANES>
+	struct updater_interleaved_table_based {
+		using table_type = table<TBL_CFG>;
+		static constexpr const table_type& table_instance() noexcept {
+			return static_table<table_type>::instance;
+		}
+	protected:
+		static constexpr void update(
+			typename TBL_CFG::T& crc, const uint8* begin, const uint8* end) noexcept {
+			interleaved_table_based_updater<TBL_CFG, LANES>::update(
+				crc, begin, end, (const basic_table<typename TBL_CFG::T>&)static_table<table_type>::instance);
+		}
+	};
+
+	// To be used as the 'UPDATER' template parameter of the 'impl' class when
+	// REF_IN != REF_REG. It receives the input bytes without bit reversal
+	// (see updater_reverses_input) and it converts the CRC register to and
+	// from the representation used by the pre_reflected_table.
+	template <typename TBL_CFG>
+	struct updater_pre_reflected_table_based {
+		using table_type = pre_reflected_table<TBL_CFG>;
+		static constexpr const table_type& table_instance() noexcept {
+			return static_table<table_type>::instance;
+		}
+	protected:
+		static constexpr void update(
+			typename TBL_CFG::T& crc, const uint8* begin, const uint8* end) noexcept {
+			typename TBL_CFG::T c = reverse_bits_of_bytes(crc);
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::table_based_update(
+				c, begin, end, (const basic_table<typename TBL_CFG::T>&)static_table<table_type>::instance);
+			crc = reverse_bits_of_bytes(c);
+		}
+	};
+
+	// To be used as the 'UPDATER' template parameter of the 'impl' class.
+	template <typename TBL_CFG, int N>
+	struct updater_sliced_table_based {
+		using table_type = sliced_table<TBL_CFG, N>;
+		static constexpr const table_type& table_instance() noexcept {
+			return static_table<table_type>::instance;
+		}
+	protected:
+		static constexpr void update(
+			typename TBL_CFG::T& crc, const uint8* begin, const uint8* end) noexcept {
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::template sliced_table_based_update<N>(
+				crc, begin, end, (const basic_sliced_table<typename TBL_CFG::T, N>&)static_table<table_type>::instance);
+		}
+	};
+
 	// To be used as the 'UPDATER' template parameter of the 'impl_ext' class.
 	template <typename TBL_CFG>
 	struct updater_ext_table_based {
@@ -781,51 +1504,656 @@ namespace crc {
 		}
 	};
 
-	// The cfg template holds the parameters of a CRC algorithm.
-	//
-	// A CRC algorithm has two reflect parameters (REF_IN, REF_OUT) while the
-	// implementation of a parametrized CRC library has an additional reflect
-	// parameter that is usually hardcoded and isn't configurable:
-	// the "reflectedness" of the CRC shift register. In this library you can
-	// configure this through the REF_REG parameter. A CRC algorithm should
-	// always work and produce the same output irrespective of the value of
-	// REF_REG but different REF_REG settings come with different trade-offs.
-	//
-	// If REF_REG!=REF_IN then the bit order has to be reversed in the bytes
-	// of the input data - this is why the default setting is REF_REG=REF_IN.
-	//
-	// CRC algorithms configured with the same POLY and REF_REG values use
-	// identical lookup tables.
-	//
-	// If you decide to set up a CRC algorithm with parameters where
-	// REF_REG!=REF_IN then the reverse_bits(uint8) function - that is
-	// otherwise unused or almost unused - starts working overtime so you have
-	// another choice to make: whether to reverse the bits of the input bytes in
-	// code or through a lookup table. This trade-off between performance and
-	// memory usage can be configured with the
-	// PARAMETRIC_CRC_NO_REVERSE_BITS_LOOKUP_TABLE define.
-	template <
-		int WIDTH_,               // bit width of the CRC shift register
-		uint<WIDTH_> POLY_,       // unreflected poly
-		uint<WIDTH_> INIT_,       // unreflected init
-		uint<WIDTH_> XOR_OUT_,
-		bool REF_IN_,             // reflected input
-		bool REF_OUT_ = REF_IN_,  // reflected output
-		bool REF_REG_ = REF_IN_   // reflected CRC shift register and table entries
-	>
-	struct cfg {
-		using T = uint<WIDTH_>;
-		static constexpr int WIDTH = WIDTH_;
-		static constexpr T POLY = POLY_;
-		static constexpr T INIT = INIT_;
-		static constexpr T XOR_OUT = XOR_OUT_;
-		static constexpr bool REF_IN = REF_IN_;
-		static constexpr bool REF_OUT = REF_OUT_;
-		static constexpr bool REF_REG = REF_REG_;
+	// To be used as the 'UPDATER' template parameter of the 'impl_ext' class.
+	template <typename TBL_CFG, int LANES>
+	struct updater_ext_interleaved_table_based {
+		using table_type = table<TBL_CFG>;
+	protected:
+		static constexpr void update(typename TBL_CFG::T& crc,
+			const uint8* begin, const uint8* end, const table_type& t) noexcept {
+			interleaved_table_based_updater<TBL_CFG, LANES>::update(
+				crc, begin, end, (const basic_table<typename TBL_CFG::T>&)t);
+		}
+	};
 
-		static constexpr T ACTUAL_INIT = conditional_reflect<T, REF_REG_>::fn(INIT_);
-		static constexpr T ACTUAL_POLY = conditional_reflect<T, REF_REG_>::fn(POLY_);
-		using TBL_CFG = tbl_cfg<WIDTH, POLY, REF_REG_>;
+	// To be used as the 'UPDATER' template parameter of the 'impl_ext' class.
+	template <typename TBL_CFG, int N>
+	struct updater_ext_sliced_table_based {
+		using table_type = sliced_table<TBL_CFG, N>;
+	protected:
+		static constexpr void update(typename TBL_CFG::T& crc,
+			const uint8* begin, const uint8* end, const table_type& t) noexcept {
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::template sliced_table_based_update<N>(
+				crc, begin, end, (const basic_sliced_table<typename TBL_CFG::T, N>&)t);
+		}
+	};
+
+	// The features of the CPU that are relevant to the hw_accelerated mode.
+	// They are detected at runtime on x86 and at compile time on ARM64.
+	struct cpu_features {
+		bool crc32c;  // SSE4.2 CRC32 or ARMv8 CRC32C instructions (CRC-32C polynomial)
+		bool crc32;   // ARMv8 CRC32 instructions (CRC-32/ISO-HDLC polynomial)
+		bool pclmul;  // x86 PCLMULQDQ carry-less multiplication (and SSSE3)
+		bool ssse3;   // x86 PSHUFB (bulk reverse_bits())
+		bool gfni;    // x86 GF2P8AFFINEQB (bulk reverse_bits())
+		bool vpclmul; // x86 VPCLMULQDQ with AVX-512F/BW and OS support for the 512-bit registers
+	};
+
+#if defined(PARAMETRIC_CRC_HW_X86)
+
+	inline void x86_cpuid(unsigned leaf, unsigned subleaf, unsigned regs[4]) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		int r[4];
+		__cpuidex(r, int(leaf), int(subleaf));
+		for (int i=0; i<4; i++)
+			regs[i] = unsigned(r[i]);
+#else
+		__cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+	}
+
+	// The XCR0 register: the register states (e.g. AVX-512) saved by the OS.
+	inline uint64 x86_xgetbv0() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+		return _xgetbv(0);
+#else
+		unsigned eax, edx;
+		__asm__("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+		return (uint64(edx) << 32) | eax;
+#endif
+	}
+
+#endif // PARAMETRIC_CRC_HW_X86
+
+	inline cpu_features detect_cpu_features() noexcept {
+		cpu_features f = {};
+#if defined(PARAMETRIC_CRC_HW_X86)
+		unsigned regs[4];  // eax, ebx, ecx, edx
+		x86_cpuid(1, 0, regs);
+		f.crc32c = (regs[2] >> 20) & 1;  // SSE4.2
+		f.pclmul = ((regs[2] >> 1) & 1) && ((regs[2] >> 9) & 1);  // PCLMULQDQ and SSSE3
+		f.ssse3 = (regs[2] >> 9) & 1;
+		// OSXSAVE and the OS saves the XMM, YMM, opmask and ZMM registers
+		bool zmm_state = ((regs[2] >> 27) & 1) && (x86_xgetbv0() & 0xe6) == 0xe6;
+		x86_cpuid(0, 0, regs);
+		if (regs[0] >= 7) {
+			x86_cpuid(7, 0, regs);
+			f.gfni = (regs[2] >> 8) & 1;
+			f.vpclmul = f.pclmul && zmm_state && ((regs[2] >> 10) & 1)  // VPCLMULQDQ
+				&& ((regs[1] >> 16) & 1) && ((regs[1] >> 30) & 1);      // AVX512F, AVX512BW
+		}
+#elif defined(PARAMETRIC_CRC_HW_ARM64)
+		f.crc32c = true;  // __ARM_FEATURE_CRC32
+		f.crc32 = true;
+#endif
+		return f;
+	}
+
+	// The result of the first (thread-safe) detection is cached.
+	inline const cpu_features& get_cpu_features() noexcept {
+		static const cpu_features features = detect_cpu_features();
+		return features;
+	}
+
+	// The CRC instructions of the CPU. Every instruction works with a single
+	// hardcoded polynomial and a reflected CRC shift register.
+	// The update() method of this generic template is never called because
+	// there is no instruction for the polynomial: available() returns false.
+	template <int WIDTH, uint<WIDTH> POLY>
+	struct hw_crc_instruction {
+		static bool available() noexcept { return false; }
+		static uint<WIDTH> update(uint<WIDTH> ref_crc, const uint8*, const uint8*) noexcept {
+			return ref_crc;
+		}
+	};
+
+#if defined(PARAMETRIC_CRC_HW_X86)
+
+	PARAMETRIC_CRC_TARGET("sse4.2")
+	inline uint32 hw_crc32c_update(uint32 crc, const uint8* p, const uint8* end) noexcept {
+#if defined(__x86_64__) || defined(_M_X64)
+		uint64 crc64 = crc;
+		for (; end - p >= 8; p += 8)
+			crc64 = _mm_crc32_u64(crc64, word_loader<uint64, true>::load(p));
+		crc = uint32(crc64);
+		if (end - p >= 4) {
+			crc = _mm_crc32_u32(crc, word_loader<uint32, true>::load(p));
+			p += 4;
+		}
+#else
+		for (; end - p >= 4; p += 4)
+			crc = _mm_crc32_u32(crc, word_loader<uint32, true>::load(p));
+#endif
+		for (; p < end; p++)
+			crc = _mm_crc32_u8(crc, *p);
+		return crc;
+	}
+
+	template <>
+	struct hw_crc_instruction<32, 0x1edc6f41> {
+		static bool available() noexcept { return get_cpu_features().crc32c; }
+		static uint32 update(uint32 ref_crc, const uint8* begin, const uint8* end) noexcept {
+			return hw_crc32c_update(ref_crc, begin, end);
+		}
+	};
+
+#elif defined(PARAMETRIC_CRC_HW_ARM64)
+
+	inline uint32 hw_crc32c_update(uint32 crc, const uint8* p, const uint8* end) noexcept {
+		for (; end - p >= 8; p += 8)
+			crc = __crc32cd(crc, word_loader<uint64, true>::load(p));
+		if (end - p >= 4) {
+			crc = __crc32cw(crc, word_loader<uint32, true>::load(p));
+			p += 4;
+		}
+		for (; p < end; p++)
+			crc = __crc32cb(crc, *p);
+		return crc;
+	}
+
+	inline uint32 hw_crc32_update(uint32 crc, const uint8* p, const uint8* end) noexcept {
+		for (; end - p >= 8; p += 8)
+			crc = __crc32d(crc, word_loader<uint64, true>::load(p));
+		if (end - p >= 4) {
+			crc = __crc32w(crc, word_loader<uint32, true>::load(p));
+			p += 4;
+		}
+		for (; p < end; p++)
+			crc = __crc32b(crc, *p);
+		return crc;
+	}
+
+	template <>
+	struct hw_crc_instruction<32, 0x1edc6f41> {
+		static bool available() noexcept { return get_cpu_features().crc32c; }
+		static uint32 update(uint32 ref_crc, const uint8* begin, const uint8* end) noexcept {
+			return hw_crc32c_update(ref_crc, begin, end);
+		}
+	};
+
+	template <>
+	struct hw_crc_instruction<32, 0x04c11db7> {
+		static bool available() noexcept { return get_cpu_features().crc32; }
+		static uint32 update(uint32 ref_crc, const uint8* begin, const uint8* end) noexcept {
+			return hw_crc32_update(ref_crc, begin, end);
+		}
+	};
+
+#endif // PARAMETRIC_CRC_HW_X86
+
+	// The constants of the folding engine that is based on carry-less
+	// multiplication. Similarly to the RESIDUE constant these are calculated
+	// at compile time from the parameters of the CRC algorithm so the engine
+	// works with any POLY, WIDTH and REF_REG.
+	//
+	// The engine processes the input in 128-bit blocks. A block is a
+	// polynomial of the form H*x^64 + L where H and L are 64-bit halves.
+	// Folding a block forward by n bits (over the next n bits of input):
+	//
+	//   (H*x^64 + L) * x^n  ===  H*K(n+64) + L*K(n)   (mod POLY)
+	//
+	// where K(n) = x^n mod POLY. Both products fit into 128 bits because the
+	// degree of K(n) is less than WIDTH<=64.
+	//
+	// With a reflected register the data and the constants are reflected.
+	// A carry-less product of two reflected 64-bit values is a reflected
+	// 127-bit value that is misaligned by one bit in the 128-bit result:
+	// bit k of a reflected 64-bit constant has to represent x^(64-k) (instead
+	// of x^(63-k)) to get a properly aligned product. In this representation
+	// the constant can't have an x^0 term so instead of K(n) we use the
+	// congruent x*K(n-1) that is exactly reverse_bits(uint64(K(n-1))).
+	template <typename TBL_CFG>
+	class clmul_fold_constants {
+		using T = typename TBL_CFG::T;
+
+		// x^n mod POLY (unreflected)
+		static constexpr T x_pow_n_mod_poly(int n) noexcept {
+			T r = 1;
+			for (int i=0; i<n; i++)
+				r = T(T(r << 1) ^ ((r >> (TBL_CFG::WIDTH-1)) ? TBL_CFG::POLY : T(0)));
+			return r;
+		}
+
+		static constexpr uint64 k(int n) noexcept {
+			return TBL_CFG::REF_REG ? reverse_bits(uint64(x_pow_n_mod_poly(n - 1))) : uint64(x_pow_n_mod_poly(n));
+		}
+
+	public:
+		// constants for the H and L halves of a block to fold it forward by
+		// 128, 256, 384 and 512 bits (and by 1024, 1536 and 2048 bits for the
+		// four 512-bit accumulators of hw_vpclmul_folding)
+		static constexpr uint64 FOLD_128_H = k(128 + 64);
+		static constexpr uint64 FOLD_128_L = k(128);
+		static constexpr uint64 FOLD_256_H = k(256 + 64);
+		static constexpr uint64 FOLD_256_L = k(256);
+		static constexpr uint64 FOLD_384_H = k(384 + 64);
+		static constexpr uint64 FOLD_384_L = k(384);
+		static constexpr uint64 FOLD_512_H = k(512 + 64);
+		static constexpr uint64 FOLD_512_L = k(512);
+		static constexpr uint64 FOLD_1024_H = k(1024 + 64);
+		static constexpr uint64 FOLD_1024_L = k(1024);
+		static constexpr uint64 FOLD_1536_H = k(1536 + 64);
+		static constexpr uint64 FOLD_1536_L = k(1536);
+		static constexpr uint64 FOLD_2048_H = k(2048 + 64);
+		static constexpr uint64 FOLD_2048_L = k(2048);
+
+	private:
+		static constexpr uint64 barrett_mu() noexcept {
+			// floor(x^128 / P') by polynomial long division, the x^64 term
+			// of the 65-bit quotient is implicit (it falls off the uint64)
+			uint64 q = 1, r = BARRETT_POLY;
+			for (int i=0; i<64; i++) {
+				uint64 lead = r >> 63;
+				q = (q << 1) | lead;
+				r = (r << 1) ^ (lead ? BARRETT_POLY : 0);
+			}
+			return q;
+		}
+
+	public:
+		// The final reduction works with the unreflected 64-bit polynomial
+		// P' = POLY * x^(64-WIDTH) regardless of REF_REG and WIDTH:
+		// (A*x^WIDTH mod POLY) * x^(64-WIDTH) = A*x^64 mod P'
+		static constexpr uint64 BARRETT_POLY = uint64(TBL_CFG::POLY) << (64 - TBL_CFG::WIDTH);  // x^64 is implicit
+		static constexpr uint64 BARRETT_K128 = uint64(x_pow_n_mod_poly(64 + TBL_CFG::WIDTH)) << (64 - TBL_CFG::WIDTH);  // x^128 mod P'
+		static constexpr uint64 BARRETT_MU = barrett_mu();
+	};
+
+#if defined(PARAMETRIC_CRC_HW_X86)
+
+	// CRC engine based on carry-less multiplication (PCLMULQDQ). It folds the
+	// input into four 128-bit accumulators, 64 bytes per iteration. At the end
+	// the accumulators are folded into a single 128-bit block A that is
+	// congruent to the whole input (mod POLY). The CRC register is
+	// A*x^WIDTH mod POLY: this is calculated with Barrett reduction.
+	// The last few bytes of the input (a partial block) take the table path.
+	template <typename TBL_CFG>
+	struct hw_clmul_folding {
+		using T = typename TBL_CFG::T;
+		using K = clmul_fold_constants<TBL_CFG>;
+
+		// the update() method requires at least this many bytes of input
+		static constexpr size_t MIN_SIZE = 64;
+
+		static bool available() noexcept {
+			return get_cpu_features().pclmul;
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static __m128i byte_order(__m128i v) noexcept {
+			// With an unreflected register the first byte of a block holds
+			// the highest coefficients of the polynomial.
+			if (!TBL_CFG::REF_REG)
+				v = _mm_shuffle_epi8(v, _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15));
+			return v;
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static __m128i load(const uint8* p) noexcept {
+			return byte_order(_mm_loadu_si128((const __m128i*)p));
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static __m128i constants(uint64 h, uint64 l) noexcept {
+			// H is in the low half of a reflected block
+			return TBL_CFG::REF_REG ? _mm_set_epi64x((long long)l, (long long)h)
+				: _mm_set_epi64x((long long)h, (long long)l);
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static __m128i fold(__m128i x, __m128i k) noexcept {
+			return _mm_xor_si128(_mm_clmulepi64_si128(x, k, 0x00), _mm_clmulepi64_si128(x, k, 0x11));
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static T update(T crc, const uint8* p, const uint8* end, const basic_table<T>& table) noexcept {
+			__m128i x0 = load(p);
+			__m128i x1 = load(p + 16);
+			__m128i x2 = load(p + 32);
+			__m128i x3 = load(p + 48);
+
+			// XORing the CRC register into the first WIDTH bits of the input
+			x0 = _mm_xor_si128(x0, TBL_CFG::REF_REG ? _mm_set_epi64x(0, (long long)crc)
+				: _mm_set_epi64x((long long)(uint64(crc) << (64 - TBL_CFG::WIDTH)), 0));
+
+			const __m128i k512 = constants(K::FOLD_512_H, K::FOLD_512_L);
+			for (p += 64; end - p >= 64; p += 64) {
+				x0 = _mm_xor_si128(fold(x0, k512), load(p));
+				x1 = _mm_xor_si128(fold(x1, k512), load(p + 16));
+				x2 = _mm_xor_si128(fold(x2, k512), load(p + 32));
+				x3 = _mm_xor_si128(fold(x3, k512), load(p + 48));
+			}
+
+			__m128i x = _mm_xor_si128(
+				_mm_xor_si128(fold(x0, constants(K::FOLD_384_H, K::FOLD_384_L)),
+				              fold(x1, constants(K::FOLD_256_H, K::FOLD_256_L))),
+				_mm_xor_si128(fold(x2, constants(K::FOLD_128_H, K::FOLD_128_L)), x3));
+
+			const __m128i k128 = constants(K::FOLD_128_H, K::FOLD_128_L);
+			for (; end - p >= 16; p += 16)
+				x = _mm_xor_si128(fold(x, k128), load(p));
+
+			crc = reduce(x);
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::table_based_update(crc, p, end, table);
+			return crc;
+		}
+
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static void clmul64(uint64 a, uint64 b, uint64 product[2]) noexcept {
+			_mm_storeu_si128((__m128i*)product, _mm_clmulepi64_si128(
+				_mm_set_epi64x(0, (long long)a), _mm_set_epi64x(0, (long long)b), 0x00));
+		}
+
+		// Returns A*x^WIDTH mod POLY where A is a 128-bit block.
+		PARAMETRIC_CRC_TARGET("pclmul,ssse3")
+		static T reduce(__m128i a) noexcept {
+			uint64 v[2];
+			_mm_storeu_si128((__m128i*)v, a);
+			// the unreflected halves of A = H*x^64 + L
+			uint64 h = TBL_CFG::REF_REG ? reverse_bits(v[0]) : v[1];
+			uint64 l = TBL_CFG::REF_REG ? reverse_bits(v[1]) : v[0];
+
+			// A*x^64 = H*x^128 + L*x^64 === H*K128 + L*x^64 = T (mod P')
+			clmul64(h, K::BARRETT_K128, v);
+			uint64 t_lo = v[0];
+			uint64 t_hi = v[1] ^ l;
+
+			// q = floor(T / P') = floor(T_hi * mu / x^64)
+			// where mu = floor(x^128 / P') = x^64 + BARRETT_MU
+			clmul64(t_hi, K::BARRETT_MU, v);
+			uint64 q = v[1] ^ t_hi;
+
+			// T - q*P' has less than 64 bits so only the lower 64 bits of
+			// q*P' = q*x^64 + q*BARRETT_POLY matter
+			clmul64(q, K::BARRETT_POLY, v);
+			uint64 r = (t_lo ^ v[0]) >> (64 - TBL_CFG::WIDTH);
+			return conditional_reflect<T, TBL_CFG::REF_REG>::fn(T(r));
+		}
+	};
+
+	// The 512-bit version of hw_clmul_folding (AVX-512 VPCLMULQDQ). A 512-bit
+	// register holds four consecutive 128-bit blocks (lanes) of the input and
+	// a VPCLMULQDQ folds the four lanes in one instruction. The input is folded
+	// into four 512-bit accumulators, 256 bytes per iteration. At the end the
+	// accumulators are folded into one and its four lanes into a single
+	// 128-bit block that continues on the path of hw_clmul_folding.
+	template <typename TBL_CFG>
+	struct hw_vpclmul_folding {
+		using T = typename TBL_CFG::T;
+		using K = clmul_fold_constants<TBL_CFG>;
+		using clmul = hw_clmul_folding<TBL_CFG>;
+
+		// the update() method requires at least this many bytes of input
+		static constexpr size_t MIN_SIZE = 256;
+
+		static bool available() noexcept {
+			return get_cpu_features().vpclmul;
+		}
+
+		PARAMETRIC_CRC_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+		static __m512i load(const uint8* p) noexcept {
+			__m512i v = _mm512_loadu_si512((const void*)p);
+			// the bytes are reversed within each lane as in hw_clmul_folding::byte_order()
+			if (!TBL_CFG::REF_REG)
+				v = _mm512_shuffle_epi8(v, _mm512_set4_epi64(
+					0x0001020304050607, 0x08090a0b0c0d0e0f, 0x0001020304050607, 0x08090a0b0c0d0e0f));
+			return v;
+		}
+
+		PARAMETRIC_CRC_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+		static __m512i constants(uint64 h, uint64 l) noexcept {
+			// the layout of hw_clmul_folding::constants() in every lane
+			return TBL_CFG::REF_REG ? _mm512_set4_epi64((long long)l, (long long)h, (long long)l, (long long)h)
+				: _mm512_set4_epi64((long long)h, (long long)l, (long long)h, (long long)l);
+		}
+
+		// returns fold(x, k) ^ y
+		PARAMETRIC_CRC_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+		static __m512i fold(__m512i x, __m512i k, __m512i y) noexcept {
+			return _mm512_ternarylogic_epi64(_mm512_clmulepi64_epi128(x, k, 0x00),
+				_mm512_clmulepi64_epi128(x, k, 0x11), y, 0x96);
+		}
+
+		// The maskz variant of _mm512_extracti32x4_epi32() doesn't trigger the
+		// bogus -Wuninitialized warning of GCC 12 in the intrinsic.
+		template <int I>
+		PARAMETRIC_CRC_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+		static __m128i lane(__m512i x) noexcept {
+			return _mm512_maskz_extracti32x4_epi32(0xf, x, I);
+		}
+
+		PARAMETRIC_CRC_TARGET("avx512f,avx512bw,vpclmulqdq,pclmul,ssse3")
+		static T update(T crc, const uint8* p, const uint8* end, const basic_table<T>& table) noexcept {
+			__m512i x0 = load(p);
+			__m512i x1 = load(p + 64);
+			__m512i x2 = load(p + 128);
+			__m512i x3 = load(p + 192);
+
+			// XORing the CRC register into the first WIDTH bits of the input (lane 0 of x0)
+			x0 = _mm512_xor_si512(x0, _mm512_inserti32x4(_mm512_setzero_si512(),
+				TBL_CFG::REF_REG ? _mm_set_epi64x(0, (long long)crc)
+				: _mm_set_epi64x((long long)(uint64(crc) << (64 - TBL_CFG::WIDTH)), 0), 0));
+
+			const __m512i k2048 = constants(K::FOLD_2048_H, K::FOLD_2048_L);
+			for (p += 256; end - p >= 256; p += 256) {
+				x0 = fold(x0, k2048, load(p));
+				x1 = fold(x1, k2048, load(p + 64));
+				x2 = fold(x2, k2048, load(p + 128));
+				x3 = fold(x3, k2048, load(p + 192));
+			}
+
+			__m512i x = fold(x0, constants(K::FOLD_1536_H, K::FOLD_1536_L),
+				fold(x1, constants(K::FOLD_1024_H, K::FOLD_1024_L),
+				fold(x2, constants(K::FOLD_512_H, K::FOLD_512_L), x3)));
+
+			const __m512i k512 = constants(K::FOLD_512_H, K::FOLD_512_L);
+			for (; end - p >= 64; p += 64)
+				x = fold(x, k512, load(p));
+
+			// lane 0 holds the first block
+			__m128i a = _mm_xor_si128(
+				_mm_xor_si128(clmul::fold(lane<0>(x), clmul::constants(K::FOLD_384_H, K::FOLD_384_L)),
+				              clmul::fold(lane<1>(x), clmul::constants(K::FOLD_256_H, K::FOLD_256_L))),
+				_mm_xor_si128(clmul::fold(lane<2>(x), clmul::constants(K::FOLD_128_H, K::FOLD_128_L)),
+				              lane<3>(x)));
+
+			const __m128i k128 = clmul::constants(K::FOLD_128_H, K::FOLD_128_L);
+			for (; end - p >= 16; p += 16)
+				a = _mm_xor_si128(clmul::fold(a, k128), clmul::load(p));
+
+			crc = clmul::reduce(a);
+			core<TBL_CFG::WIDTH, TBL_CFG::REF_REG>::table_based_update(crc, p, end, table);
+			return crc;
+		}
+	};
+
+#else
+
+	template <typename TBL_CFG>
+	struct hw_clmul_folding {
+		using T = typename TBL_CFG::T;
+		static constexpr size_t MIN_SIZE = 64;
+		static bool available() noexcept { return false; }
+		static T update(T crc, const uint8*, const uint8*, const basic_table<T>&) noexcept { return crc; }
+	};
+
+	template <typename TBL_CFG>
+	struct hw_vpclmul_folding {
+		using T = typename TBL_CFG::T;
+		static constexpr size_t MIN_SIZE = 256;
+		static bool available() noexcept { return false; }
+		static T update(T crc, const uint8*, const uint8*, const basic_table<T>&) noexcept { return crc; }
+	};
+
+#endif // PARAMETRIC_CRC_HW_X86
+
+	// The engines the hw_accelerated mode can pick from at runtime.
+	enum class engine {
+		table_based,      // the table_based mode (no usable CPU instructions)
+		crc_instruction,  // the CRC instruction of the CPU (CRC-32C and CRC-32/ISO-HDLC)
+		clmul,            // carry-less multiplication (with the above or table_based for short inputs)
+		vpclmul,          // 512-bit carry-less multiplication for large inputs (with clmul for the rest)
+	};
+
+	constexpr const char* engine_name(engine e) noexcept {
+		return e == engine::vpclmul ? "vpclmul" : e == engine::clmul ? "clmul"
+			: e == engine::crc_instruction ? "crc_instruction" : "table_based";
+	}
+
+	// To be used as the 'UPDATER' template parameter of the 'impl' class.
+	// Uses the carry-less multiplication based folding engine with buffers
+	// of at least hw_clmul_folding<>::MIN_SIZE bytes (its 512-bit version with
+	// at least PARAMETRIC_CRC_VPCLMUL_MIN_SIZE bytes) and the CRC instruction
+	// of the CPU with shorter buffers if there is an instruction for
+	// TBL_CFG::POLY. Falls back to the table_based update if none of these
+	// are available or if the update is evaluated at compile time.
+	// The CRC instructions work with a reflected CRC shift register: in case
+	// of REF_REG=false the bits of every input byte would have to be reversed
+	// so the CRC instructions are used only with REF_REG=true.
+	//
+	// The engine is selected only once per TBL_CFG: the first runtime update
+	// probes the CPU features and caches a pointer to the update function of
+	// the engine. The selected_engine() method reports the choice.
+	template <typename TBL_CFG>
+	struct updater_hw_accelerated : public updater_table_based<TBL_CFG> {
+	private:
+		using T = typename TBL_CFG::T;
+		using update_fn = void (*)(T& crc, const uint8* begin, const uint8* end);
+
+		struct dispatch_entry {
+			update_fn fn;
+			engine id;
+		};
+
+		static void table_based_engine(T& crc, const uint8* begin, const uint8* end) noexcept {
+			updater_table_based<TBL_CFG>::update(crc, begin, end);
+		}
+
+		static void crc_instruction_engine(T& crc, const uint8* begin, const uint8* end) noexcept {
+			crc = hw_crc_instruction<TBL_CFG::WIDTH, TBL_CFG::POLY>::update(crc, begin, end);
+		}
+
+		// The fixed cost of the final reduction of the folding engine makes
+		// the CRC instruction faster with short buffers.
+		template <bool CRC_INSTRUCTION>
+		static void clmul_engine(T& crc, const uint8* begin, const uint8* end) noexcept {
+			using clmul = hw_clmul_folding<TBL_CFG>;
+			if (size_t(end - begin) >= (CRC_INSTRUCTION ? 256 : clmul::MIN_SIZE))
+				crc = clmul::update(crc, begin, end, (const basic_table<T>&)
+					updater_table_based<TBL_CFG>::table_instance());
+			else if (CRC_INSTRUCTION)
+				crc_instruction_engine(crc, begin, end);
+			else
+				table_based_engine(crc, begin, end);
+		}
+
+		template <bool CRC_INSTRUCTION>
+		static void vpclmul_engine(T& crc, const uint8* begin, const uint8* end) noexcept {
+			using vpclmul = hw_vpclmul_folding<TBL_CFG>;
+			static_assert(PARAMETRIC_CRC_VPCLMUL_MIN_SIZE >= vpclmul::MIN_SIZE, "PARAMETRIC_CRC_VPCLMUL_MIN_SIZE < 256");
+			if (size_t(end - begin) >= PARAMETRIC_CRC_VPCLMUL_MIN_SIZE)
+				crc = vpclmul::update(crc, begin, end, (const basic_table<T>&)
+					updater_table_based<TBL_CFG>::table_instance());
+			else
+				clmul_engine<CRC_INSTRUCTION>(crc, begin, end);
+		}
+
+		static dispatch_entry select() noexcept {
+			bool crc_instruction = TBL_CFG::REF_REG &&
+				hw_crc_instruction<TBL_CFG::WIDTH, TBL_CFG::POLY>::available();
+			if (hw_vpclmul_folding<TBL_CFG>::available()) {
+				if (crc_instruction)
+					return { &vpclmul_engine<true>, engine::vpclmul };
+				return { &vpclmul_engine<false>, engine::vpclmul };
+			}
+			if (hw_clmul_folding<TBL_CFG>::available()) {
+				if (crc_instruction)
+					return { &clmul_engine<true>, engine::clmul };
+				return { &clmul_engine<false>, engine::clmul };
+			}
+			if (crc_instruction)
+				return { &crc_instruction_engine, engine::crc_instruction };
+			return { &table_based_engine, engine::table_based };
+		}
+
+		// thread-safe initialization on the first call
+		static const dispatch_entry& dispatch() noexcept {
+			static const dispatch_entry entry = select();
+			return entry;
+		}
+
+	public:
+		// The engine used by runtime updates on this CPU.
+		static engine selected_engine() noexcept {
+#if defined(PARAMETRIC_CRC_HW_X86) || defined(PARAMETRIC_CRC_HW_ARM64)
+			return dispatch().id;
+#else
+			return engine::table_based;
+#endif
+		}
+
+	protected:
+		static constexpr void update(T& crc, const uint8* begin, const uint8* end) noexcept {
+#if defined(PARAMETRIC_CRC_HW_X86) || defined(PARAMETRIC_CRC_HW_ARM64)
+			if (!PARAMETRIC_CRC_IS_CONSTANT_EVALUATED()) {
+				dispatch().fn(crc, begin, end);
+				return;
+			}
+#endif
+			updater_table_based<TBL_CFG>::update(crc, begin, end);
+		}
+	};
+
+	// The cfg template holds the parameters of a CRC algorithm.
+	//
+	// A CRC algorithm has two reflect parameters (REF_IN, REF_OUT) while the
+	// implementation of a parametrized CRC library has an additional reflect
+	// parameter that is usually hardcoded and isn't configurable:
+	// the "reflectedness" of the CRC shift register. In this library you can
+	// configure this through the REF_REG parameter. A CRC algorithm should
+	// always work and produce the same output irrespective of the value of
+	// REF_REG but different REF_REG settings come with different trade-offs.
+	//
+	// If REF_REG!=REF_IN then the bit order has to be reversed in the bytes
+	// of the input data - this is why the default setting is REF_REG=REF_IN.
+	//
+	// CRC algorithms configured with the same POLY and REF_REG values use
+	// identical lookup tables. The default REF_REG can be changed with the
+	// PARAMETRIC_CRC_DEFAULT_REF_REG(REF_IN) macro. Defining it as true makes
+	// all algorithms with the same POLY (e.g. crc16::kermit and
+	// crc16::xmodem) share their tables at the cost of reversing the bits of
+	// the input bytes of the unreflected ones (see pre_reflected_table_based
+	// and the table_usage<> template for details).
+	//
+	// If you decide to set up a CRC algorithm with parameters where
+	// REF_REG!=REF_IN then the reverse_bits(uint8) function - that is
+	// otherwise unused or almost unused - starts working overtime so you have
+	// another choice to make: whether to reverse the bits of the input bytes in
+	// code or through a lookup table. This trade-off between performance and
+	// memory usage can be configured with the
+	// PARAMETRIC_CRC_NO_REVERSE_BITS_LOOKUP_TABLE define.
+	template <
+		int WIDTH_,               // bit width of the CRC shift register
+		uint<WIDTH_> POLY_,       // unreflected poly
+		uint<WIDTH_> INIT_,       // unreflected init
+		uint<WIDTH_> XOR_OUT_,
+		bool REF_IN_,             // reflected input
+		bool REF_OUT_ = REF_IN_,  // reflected output
+		bool REF_REG_ = PARAMETRIC_CRC_DEFAULT_REF_REG(REF_IN_)   // reflected CRC shift register and table entries
+	>
+	struct cfg {
+		using T = uint<WIDTH_>;
+		static constexpr int WIDTH = WIDTH_;
+		static constexpr T POLY = POLY_;
+		static constexpr T INIT = INIT_;
+		static constexpr T XOR_OUT = XOR_OUT_;
+		static constexpr bool REF_IN = REF_IN_;
+		static constexpr bool REF_OUT = REF_OUT_;
+		static constexpr bool REF_REG = REF_REG_;
+
+		static constexpr T ACTUAL_INIT = conditional_reflect<T, REF_REG_>::fn(INIT_);
+		static constexpr T ACTUAL_POLY = conditional_reflect<T, REF_REG_>::fn(POLY_);
+		using TBL_CFG = tbl_cfg<WIDTH, POLY, REF_REG_>;
 	};
 
 	// Calculates the residue constant. This implementation is based on the
@@ -902,8 +2230,824 @@ namespace crc {
 
 	public:
 		static constexpr T RESIDUE = residue_const();
+
+		// The contents of the CRC register after reading an error-free
+		// codeword: comparing the register with this constant skips the
+		// reflection of residue().
+		static constexpr T REGISTER_RESIDUE = conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(RESIDUE);
+	};
+
+	// Feeds the first num_bits (1..7) bits of a byte into the CRC register
+	// in the bit order of the algorithm: the least significant bits come
+	// first if REF_IN is true and the most significant bits otherwise. The
+	// rest of the bits of the byte are ignored.
+	template <typename CFG>
+	struct partial_byte_updater {
+		static constexpr void update(typename CFG::T& crc, uint8 b, unsigned num_bits) noexcept {
+			b &= CFG::REF_IN ? uint8((1u << num_bits) - 1) : uint8(0xff << (8 - num_bits));
+			if (CFG::REF_IN != CFG::REF_REG)
+				b = reverse_bits(b);
+			core<CFG::WIDTH, CFG::REF_REG>::bbb_update(CFG::ACTUAL_POLY, crc, b, uint8(num_bits));
+		}
+	};
+
+	// The size of the blocks of the patch() methods on the stack.
+	static constexpr size_t PATCH_BLOCK_SIZE = 256;
+
+	// Combines the CRCs of two consecutive chunks (A and B) of the input
+	// without having to process their data again, like crc32_combine() of
+	// zlib. The CRC register is linear: after processing B the register holds
+	// (start * x^(8*size_b) + f(B)) mod POLY where start is the contents of the
+	// register before B and f(B) depends only on the data. The interim
+	// remainder of B was calculated with start=ACTUAL_INIT so replacing that
+	// start value with the interim remainder of A yields the interim
+	// remainder of AB. The x^(8*size_b) multiplication runs in O(log(size_b))
+	// time, the chunks themselves may have been processed by any mode.
+	//
+	// The same linearity allows patching: replacing n bytes at an offset
+	// changes the register by the register of the XOR of the old and new
+	// bytes (calculated from zero) shifted by the bytes that follow them.
+	template <typename CFG>
+	class combine_calculator {
+		using T = typename CFG::T;
+		using core_type = core<CFG::WIDTH, CFG::REF_REG>;
+
+	public:
+		static constexpr void zeros_update(T& crc, size_t size) noexcept {
+			core_type::zeros_update(CFG::ACTUAL_POLY, crc, size);
+		}
+
+		static constexpr T interim_to_final(T interim) noexcept {
+			return conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(interim) ^ CFG::XOR_OUT;
+		}
+
+		static constexpr T final_to_interim(T crc) noexcept {
+			return conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(T(crc ^ CFG::XOR_OUT));
+		}
+
+		static constexpr T combine_interim(T interim_a, T interim_b, size_t size_b) noexcept {
+			T crc = interim_a ^ CFG::ACTUAL_INIT;
+			zeros_update(crc, size_b);
+			return crc ^ interim_b;
+		}
+
+		static constexpr T combine(T crc_a, T crc_b, size_t size_b) noexcept {
+			return interim_to_final(combine_interim(
+				final_to_interim(crc_a), final_to_interim(crc_b), size_b));
+		}
+
+		// The UPDATE_FN is the update method of the impl or impl_ext class as
+		// a function object. The XOR of the old and new bytes is passed to it
+		// in blocks of PATCH_BLOCK_SIZE bytes. The patched range has to lie
+		// inside the message (offset + n <= size).
+		template <typename UPDATE_FN>
+		static T patch(const UPDATE_FN& update, T crc, size_t size, size_t offset,
+				const uint8* old_data, const uint8* new_data, size_t n) noexcept {
+			PARAMETRIC_CRC_ASSERT(offset <= size && n <= size - offset);
+			uint8 block[PATCH_BLOCK_SIZE];
+			T delta = 0;
+			for (size_t i=0; i<n; ) {
+				size_t block_size = n - i < PATCH_BLOCK_SIZE ? n - i : PATCH_BLOCK_SIZE;
+				for (size_t j=0; j<block_size; j++)
+					block[j] = old_data[i+j] ^ new_data[i+j];
+				update(delta, block, block + block_size);
+				i += block_size;
+			}
+			zeros_update(delta, size - offset - n);
+			return crc ^ conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(delta);
+		}
+	};
+
+	// The number of messages calculate_batch() processes in lockstep with a
+	// mode. Lockstep processing makes sense only with modes that perform a
+	// serial chain of dependent operations per byte: the per-byte steps of
+	// the messages don't depend on each other so the CPU can execute them in
+	// parallel. The other modes process the messages one by one.
+	template <typename UPDATER>
+	struct batch_lanes { static constexpr int LANES = 1; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_tableless<TBL_CFG>> { static constexpr int LANES = 4; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_tableless_fast<TBL_CFG>> { static constexpr int LANES = 4; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_table_based<TBL_CFG>> { static constexpr int LANES = 4; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_small_table_based<TBL_CFG>> { static constexpr int LANES = 4; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_ext_table_based<TBL_CFG>> { static constexpr int LANES = 4; };
+	template <typename TBL_CFG>
+	struct batch_lanes<updater_ext_small_table_based<TBL_CFG>> { static constexpr int LANES = 4; };
+
+	// The message sources of calculate_batch(): an array of pointers with an
+	// array of sizes or fixed size messages placed at a fixed stride.
+	struct batch_messages {
+		const void* const* ptrs;
+		const size_t* sizes;
+		void get(size_t i, const uint8*& p, size_t& size) const noexcept {
+			p = (const uint8*)ptrs[i];
+			size = sizes[i];
+		}
+	};
+
+	struct strided_batch_messages {
+		const uint8* data;
+		size_t size;
+		size_t stride;
+		void get(size_t i, const uint8*& p, size_t& size_) const noexcept {
+			p = data + i * stride;
+			size_ = size;
+		}
+	};
+
+	// The messages of a batch starting at the index first.
+	template <typename MESSAGES>
+	struct offset_batch_messages {
+		const MESSAGES& messages;
+		size_t first;
+		void get(size_t i, const uint8*& p, size_t& size) const noexcept {
+			messages.get(first + i, p, size);
+		}
+	};
+
+	// The verify_batch() methods calculate the CRCs of this many codewords
+	// at a time into a buffer on the stack.
+	static constexpr size_t VERIFY_BATCH_BLOCK_SIZE = 64;
+
+	// Table-driven update of a compile-time number of bytes. The recursion
+	// unrolls the loop completely so it is meant for short keys.
+	template <size_t N>
+	struct unrolled_table_update {
+		template <typename CORE, bool REVERSE_INPUT, typename T, typename TABLE>
+		static constexpr void update(T& crc, const uint8* p, const TABLE& table) noexcept {
+			CORE::table_based_update(crc, REVERSE_INPUT ? reverse_bits(p[0]) : p[0], table);
+			unrolled_table_update<N-1>::template update<CORE, REVERSE_INPUT>(crc, p + 1, table);
+		}
+	};
+	template <>
+	struct unrolled_table_update<0> {
+		template <typename CORE, bool REVERSE_INPUT, typename T, typename TABLE>
+		static constexpr void update(T&, const uint8*, const TABLE&) noexcept {}
+	};
+
+	// Calculates the CRC of a key of N bytes (see parametric::hash_fixed()).
+	// At runtime the CRC instruction of the CPU replaces the table when
+	// there is one for the algorithm. Its input has to be reflected so
+	// REF_IN and REF_REG must both be true.
+	template <typename CFG, size_t N>
+	struct fixed_size_hasher {
+		using T = typename CFG::T;
+
+		static constexpr T finalize(T crc) noexcept {
+			return conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(crc) ^ CFG::XOR_OUT;
+		}
+
+		static constexpr T hash(const uint8* key) noexcept {
+#if defined(PARAMETRIC_CRC_HW_X86) || defined(PARAMETRIC_CRC_HW_ARM64)
+			using instruction = hw_crc_instruction<CFG::WIDTH, CFG::POLY>;
+			if (CFG::REF_IN && CFG::REF_REG && !PARAMETRIC_CRC_IS_CONSTANT_EVALUATED() && instruction::available())
+				return finalize(instruction::update(CFG::ACTUAL_INIT, key, key + N));
+#endif
+			T crc = CFG::ACTUAL_INIT;
+			unrolled_table_update<N>::template update<core<CFG::WIDTH, CFG::REF_REG>, CFG::REF_IN!=CFG::REF_REG>(
+				crc, key, (const basic_table<T>&)static_table<table<typename CFG::TBL_CFG>>::instance);
+			return finalize(crc);
+		}
+	};
+
+	// A buffer of a scatter/gather list for the update(segs, count) methods.
+	// Its layout is the same as that of the POSIX struct iovec.
+	struct segment {
+		const void* data;
+		size_t size;
+	};
+
+	// The update(segs, count) methods pass the segments to the updater in
+	// blocks of at least this many bytes when possible. Segments (or their
+	// ends) shorter than this are collected in a stash on the stack together
+	// with the beginning of the next segment so the seams don't degrade the
+	// block based code paths (sliced, interleaved, hw_accelerated) to byte
+	// by byte processing. The clmul engine of the hw_accelerated mode starts
+	// folding at 256 bytes.
+	static constexpr size_t SEGMENT_STASH_SIZE = 256;
+
+	// Feeds the concatenation of the segments into the CRC register. The
+	// UPDATE_FN is the update method of the impl or impl_ext class as a
+	// function object.
+	template <typename UPDATE_FN, typename T>
+	void update_segments(const UPDATE_FN& update, T& crc, const segment* segs, size_t count) noexcept {
+		uint8 stash[SEGMENT_STASH_SIZE];
+		size_t stashed = 0;
+		for (size_t i=0; i<count; i++) {
+			const uint8* p = (const uint8*)segs[i].data;
+			const uint8* end = p + segs[i].size;
+			if (stashed) {
+				while (stashed < SEGMENT_STASH_SIZE && p < end)
+					stash[stashed++] = *p++;
+				if (stashed < SEGMENT_STASH_SIZE)
+					continue;
+				update(crc, stash, stash + stashed);
+				stashed = 0;
+			}
+			if (size_t(end - p) >= SEGMENT_STASH_SIZE) {
+				// long segments are passed to the updater without copying
+				update(crc, p, end);
+				continue;
+			}
+			while (p < end)
+				stash[stashed++] = *p++;
+		}
+		if (stashed)
+			update(crc, stash, stash + stashed);
+	}
+
+	// The copy_and_update() methods process the input in blocks of this size.
+	// The CRC engine reads a block first and the copy of the block reads it
+	// again from the L1 cache so the source is loaded from memory only once.
+	// The engines with a fixed cost per call (e.g. the final reduction of the
+	// clmul folding) need a few KiB per call to amortize it.
+	static constexpr size_t COPY_BLOCK_SIZE = 8192;
+
+	inline void copy_bytes(uint8* dst, const uint8* src, size_t size) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_memcpy(dst, src, size);
+#else
+		for (size_t i=0; i<size; i++)
+			dst[i] = src[i];
+#endif
+	}
+
+	// Copies with non-temporal stores that bypass the caches. It suits large
+	// copies whose destination won't be read soon (e.g. a ring buffer that
+	// is consumed by a device).
+#if defined(PARAMETRIC_CRC_HW_X86)
+	PARAMETRIC_CRC_TARGET("sse2")
+	inline void copy_bytes_non_temporal(uint8* dst, const uint8* src, size_t size) noexcept {
+		size_t head = (16 - ((size_t)dst & 15)) & 15;
+		if (head > size)
+			head = size;
+		copy_bytes(dst, src, head);
+		dst += head;
+		src += head;
+		size -= head;
+		for (; size >= 64; size -= 64, dst += 64, src += 64) {
+			__m128i a = _mm_loadu_si128((const __m128i*)src);
+			__m128i b = _mm_loadu_si128((const __m128i*)(src + 16));
+			__m128i c = _mm_loadu_si128((const __m128i*)(src + 32));
+			__m128i d = _mm_loadu_si128((const __m128i*)(src + 48));
+			_mm_stream_si128((__m128i*)dst, a);
+			_mm_stream_si128((__m128i*)(dst + 16), b);
+			_mm_stream_si128((__m128i*)(dst + 32), c);
+			_mm_stream_si128((__m128i*)(dst + 48), d);
+		}
+		for (; size >= 16; size -= 16, dst += 16, src += 16)
+			_mm_stream_si128((__m128i*)dst, _mm_loadu_si128((const __m128i*)src));
+		copy_bytes(dst, src, size);
+		// the non-temporal stores are weakly ordered
+		_mm_sfence();
+	}
+#else
+	inline void copy_bytes_non_temporal(uint8* dst, const uint8* src, size_t size) noexcept {
+		copy_bytes(dst, src, size);
+	}
+#endif
+
+	// Copies size bytes from src to dst and feeds them into the CRC register
+	// in a single pass over the source (see COPY_BLOCK_SIZE). The UPDATE_FN
+	// is the update method of the impl or impl_ext class as a function object.
+	template <bool NON_TEMPORAL, typename UPDATE_FN, typename T>
+	void copy_and_update_blocks(const UPDATE_FN& update, T& crc, uint8* dst, const uint8* src, size_t size) noexcept {
+		while (size) {
+			size_t block_size = size < COPY_BLOCK_SIZE ? size : COPY_BLOCK_SIZE;
+			update(crc, src, src + block_size);
+			if (NON_TEMPORAL)
+				copy_bytes_non_temporal(dst, src, block_size);
+			else
+				copy_bytes(dst, src, block_size);
+			dst += block_size;
+			src += block_size;
+			size -= block_size;
+		}
+	}
+
+	// Feeds size bytes of every lane into the CRC register of the lane in
+	// lockstep. The lanes are unrolled with templates and copied into local
+	// variables to allow the compiler to keep the registers in CPU registers.
+	template <int LANES>
+	struct batch_lane_steps;
+
+	template <>
+	struct batch_lane_steps<4> {
+		template <typename UPDATE_FN, typename T>
+		static void update(const UPDATE_FN& update, T* crc, const uint8* const* p, size_t size) noexcept {
+			T c0 = crc[0], c1 = crc[1], c2 = crc[2], c3 = crc[3];
+			const uint8 *p0 = p[0], *p1 = p[1], *p2 = p[2], *p3 = p[3];
+			for (size_t i=0; i<size; i++) {
+				update(c0, p0 + i, p0 + i + 1);
+				update(c1, p1 + i, p1 + i + 1);
+				update(c2, p2 + i, p2 + i + 1);
+				update(c3, p3 + i, p3 + i + 1);
+			}
+			crc[0] = c0; crc[1] = c1; crc[2] = c2; crc[3] = c3;
+		}
+	};
+
+	// Calculates the CRCs of n messages with LANES messages in flight. When
+	// a message of a lane ends its CRC is written to the output and the lane
+	// continues with the next message. The UPDATE_FN is the update method of
+	// the impl or impl_ext class as a function object. The output is the
+	// final CRC or the interim value of the CRC register if FINAL is false.
+	template <typename CFG, int LANES, bool FINAL=true>
+	struct batch_calculator {
+		using T = typename CFG::T;
+
+		static T output(T crc) noexcept {
+			return FINAL ? combine_calculator<CFG>::interim_to_final(crc) : crc;
+		}
+
+		template <typename UPDATE_FN, typename MESSAGES>
+		static void calculate(const UPDATE_FN& update, const MESSAGES& messages, T* out, size_t n) noexcept {
+			const uint8* p[LANES] = {};
+			size_t left[LANES] = {};
+			size_t index[LANES] = {};
+			bool active[LANES] = {};
+			T crc[LANES] = {};
+
+			size_t next = 0;
+			if (n >= size_t(LANES)) {
+				for (int k=0; k<LANES; k++) {
+					messages.get(next, p[k], left[k]);
+					index[k] = next++;
+					active[k] = true;
+					crc[k] = CFG::ACTUAL_INIT;
+				}
+				for (;;) {
+					size_t step = left[0];
+					for (int k=1; k<LANES; k++)
+						step = left[k] < step ? left[k] : step;
+					batch_lane_steps<LANES>::update(update, crc, p, step);
+
+					bool refilled = true;
+					for (int k=0; k<LANES; k++) {
+						p[k] += step;
+						left[k] -= step;
+						if (left[k])
+							continue;
+						out[index[k]] = output(crc[k]);
+						if (next == n) {
+							active[k] = false;
+							refilled = false;
+							continue;
+						}
+						messages.get(next, p[k], left[k]);
+						index[k] = next++;
+						crc[k] = CFG::ACTUAL_INIT;
+					}
+					if (!refilled)
+						break;
+				}
+				// finishing the messages in progress after running out of new ones
+				for (int k=0; k<LANES; k++) {
+					if (!active[k])
+						continue;
+					update(crc[k], p[k], p[k] + left[k]);
+					out[index[k]] = output(crc[k]);
+				}
+			}
+
+			for (; next<n; next++) {
+				T c = CFG::ACTUAL_INIT;
+				messages.get(next, p[0], left[0]);
+				update(c, p[0], p[0] + left[0]);
+				out[next] = output(c);
+			}
+		}
+	};
+
+	template <typename CFG, bool FINAL>
+	struct batch_calculator<CFG, 1, FINAL> {
+		using T = typename CFG::T;
+
+		static T output(T crc) noexcept {
+			return FINAL ? combine_calculator<CFG>::interim_to_final(crc) : crc;
+		}
+
+		template <typename UPDATE_FN, typename MESSAGES>
+		static void calculate(const UPDATE_FN& update, const MESSAGES& messages, T* out, size_t n) noexcept {
+			for (size_t i=0; i<n; i++) {
+				const uint8* p = nullptr;
+				size_t size = 0;
+				messages.get(i, p, size);
+				T crc = CFG::ACTUAL_INIT;
+				update(crc, p, p + size);
+				out[i] = output(crc);
+			}
+		}
+	};
+
+	// Checks n codewords: valid[i] is set to true if the i-th codeword is
+	// error-free. Like verify() it compares the interim CRC registers with
+	// REGISTER_RESIDUE without branches. Returns the number of error-free
+	// codewords.
+	template <typename CFG, int LANES>
+	struct batch_verifier {
+		using T = typename CFG::T;
+
+		template <typename UPDATE_FN, typename MESSAGES>
+		static size_t verify(const UPDATE_FN& update, const MESSAGES& messages, bool* valid, size_t n) noexcept {
+			const T valid_crc = residue_const_calculator<CFG>::REGISTER_RESIDUE;
+			T crcs[VERIFY_BATCH_BLOCK_SIZE];
+			size_t num_valid = 0;
+			for (size_t first=0; first<n; first+=VERIFY_BATCH_BLOCK_SIZE) {
+				size_t count = n - first < VERIFY_BATCH_BLOCK_SIZE ? n - first : VERIFY_BATCH_BLOCK_SIZE;
+				batch_calculator<CFG, LANES, false>::calculate(update,
+					offset_batch_messages<MESSAGES>{messages, first}, crcs, count);
+				for (size_t i=0; i<count; i++) {
+					bool ok = crcs[i] == valid_crc;
+					valid[first + i] = ok;
+					num_valid += ok;
+				}
+			}
+			return num_valid;
+		}
+	};
+
+	// The maximum number of tasks parallel_calculate() splits its input into.
+	static constexpr size_t PARALLEL_MAX_TASKS = 64;
+
+#ifdef PARAMETRIC_CRC_THREADS
+	// Joins the started threads of an array when it goes out of scope.
+	struct thread_joiner {
+		std::thread* threads;
+		size_t count;
+		~thread_joiner() {
+			for (size_t i=0; i<count; i++)
+				if (threads[i].joinable())
+					threads[i].join();
+		}
+	};
+
+	// An executor for parallel_calculate() that runs the first task on the
+	// calling thread and each of the others on a new std::thread. If a
+	// thread can't be started then the std::system_error of std::thread
+	// propagates after the already started threads have been joined.
+	struct thread_executor {
+		template <typename TASK>
+		void operator()(size_t num_tasks, const TASK& task) const {
+			std::thread threads[PARALLEL_MAX_TASKS];
+			thread_joiner joiner = { threads, num_tasks };
+			for (size_t i=1; i<num_tasks; i++)
+				threads[i] = std::thread(task, i);
+			task(0);
+		}
+	};
+#endif
+
+	// The input reversers below (REF_IN != REF_REG) pass the input to the
+	// updater in blocks of reversed bytes stored on the stack. Shorter inputs
+	// are passed byte by byte to avoid the initialization of the block.
+	static constexpr int REVERSED_INPUT_BLOCK_SIZE = 512;
+	static constexpr int REVERSED_INPUT_MIN_BLOCK_SIZE = 16;
+
+	// Reverses the bits of each of the n bytes of the input (in) into the
+	// output (out). The input and the output can be the same buffer.
+	inline void reverse_bits_bytewise(const uint8* in, uint8* out, size_t n) noexcept {
+		for (size_t i=0; i<n; i++)
+			out[i] = reverse_bits(in[i]);
+	}
+
+#if defined(PARAMETRIC_CRC_HW_X86)
+
+	// The bit reversal of a byte is an affine transformation over GF(2) with
+	// an anti-diagonal matrix: 16 bytes per instruction.
+	PARAMETRIC_CRC_TARGET("gfni,sse2")
+	inline void reverse_bits_gfni(const uint8* in, uint8* out, size_t n) noexcept {
+		const __m128i matrix = _mm_set1_epi64x(0x8040201008040201);
+		size_t i = 0;
+		for (; i+16 <= n; i+=16) {
+			__m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+			_mm_storeu_si128((__m128i*)(out + i), _mm_gf2p8affine_epi64_epi8(v, matrix, 0));
+		}
+		reverse_bits_bytewise(in + i, out + i, n - i);
+	}
+
+	// Two 16-entry nibble lookups per byte with PSHUFB: 16 bytes per iteration.
+	PARAMETRIC_CRC_TARGET("ssse3")
+	inline void reverse_bits_ssse3(const uint8* in, uint8* out, size_t n) noexcept {
+		// the reversed low nibble becomes the high nibble and vice versa
+		const __m128i lo_to_hi = _mm_setr_epi8(0x00, char(0x80), 0x40, char(0xc0), 0x20, char(0xa0), 0x60, char(0xe0),
+			0x10, char(0x90), 0x50, char(0xd0), 0x30, char(0xb0), 0x70, char(0xf0));
+		const __m128i hi_to_lo = _mm_setr_epi8(0x0, 0x8, 0x4, 0xc, 0x2, 0xa, 0x6, 0xe,
+			0x1, 0x9, 0x5, 0xd, 0x3, 0xb, 0x7, 0xf);
+		const __m128i nibble_mask = _mm_set1_epi8(0x0f);
+		size_t i = 0;
+		for (; i+16 <= n; i+=16) {
+			__m128i v = _mm_loadu_si128((const __m128i*)(in + i));
+			__m128i lo = _mm_and_si128(v, nibble_mask);
+			__m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble_mask);
+			v = _mm_or_si128(_mm_shuffle_epi8(lo_to_hi, lo), _mm_shuffle_epi8(hi_to_lo, hi));
+			_mm_storeu_si128((__m128i*)(out + i), v);
+		}
+		reverse_bits_bytewise(in + i, out + i, n - i);
+	}
+
+#elif defined(PARAMETRIC_CRC_HW_ARM64)
+
+	inline void reverse_bits_neon(const uint8* in, uint8* out, size_t n) noexcept {
+		size_t i = 0;
+		for (; i+16 <= n; i+=16)
+			vst1q_u8(out + i, vrbitq_u8(vld1q_u8(in + i)));
+		reverse_bits_bytewise(in + i, out + i, n - i);
+	}
+
+#endif
+
+	using reverse_bits_fn = void (*)(const uint8* in, uint8* out, size_t n);
+
+	inline reverse_bits_fn select_reverse_bits() noexcept {
+#if defined(PARAMETRIC_CRC_HW_X86)
+		if (get_cpu_features().gfni)
+			return &reverse_bits_gfni;
+		if (get_cpu_features().ssse3)
+			return &reverse_bits_ssse3;
+#elif defined(PARAMETRIC_CRC_HW_ARM64)
+		return &reverse_bits_neon;
+#endif
+		return &reverse_bits_bytewise;
+	}
+
+	// Bulk version of reverse_bits(uint8) with the SIMD instructions of the
+	// CPU (x86 GFNI or SSSE3, ARM64 NEON) selected at the first call.
+	inline void reverse_bits(const uint8* in, uint8* out, size_t n) noexcept {
+		static const reverse_bits_fn fn = select_reverse_bits();
+		fn(in, out, n);
+	}
+
+	// Reverses the bits of the bytes of the next block of the input into the
+	// block buffer and returns the size of the block.
+	constexpr size_t reverse_input_block(const uint8* p, const uint8* end, uint8* block) noexcept {
+		size_t n = end - p < REVERSED_INPUT_BLOCK_SIZE ? size_t(end - p) : size_t(REVERSED_INPUT_BLOCK_SIZE);
+#if defined(PARAMETRIC_CRC_HW_X86) || defined(PARAMETRIC_CRC_HW_ARM64)
+		if (!PARAMETRIC_CRC_IS_CONSTANT_EVALUATED()) {
+			reverse_bits(p, block, n);
+			return n;
+		}
+#endif
+		for (size_t i=0; i<n; i++)
+			block[i] = reverse_bits(p[i]);
+		return n;
+	}
+
+	// Tells whether the updater expects the input bytes without bit reversal
+	// even if REF_IN != REF_REG (it reverses them itself or doesn't need to).
+	template <typename UPDATER>
+	struct updater_reverses_input { static constexpr bool VALUE = false; };
+	template <typename TBL_CFG>
+	struct updater_reverses_input<updater_pre_reflected_table_based<TBL_CFG>> { static constexpr bool VALUE = true; };
+
+#ifdef PARAMETRIC_CRC_STATS
+
+	// The number of buckets of stats::size_histogram. Bucket i counts the
+	// calls with a size in the range [2^(i-1), 2^i) and bucket 0 counts the
+	// empty calls. The last bucket counts the larger calls too.
+	static constexpr int STATS_HISTOGRAM_BUCKETS = 24;
+
+	// The counters of a CRC algorithm and mode on the current thread. The
+	// calls are the update() calls (including the ones made by calculate()),
+	// the segment lists, the blocks of copy_and_update() and patch() and the
+	// messages of calculate_batch(). The bytes of patch() are the n modified
+	// bytes, its O(log(size)) shift over the rest of the buffer isn't counted.
+	struct stats {
+		int width;
+		uint64 poly;
+		const char* mode;     // e.g. "table_based" or the engine of hw_accelerated ("clmul")
+		uint64 calls;
+		uint64 bytes;
+		uint64 nanoseconds;   // 0 without PARAMETRIC_CRC_STATS_TIMING
+		uint64 size_histogram[STATS_HISTOGRAM_BUCKETS];
+		stats* next;          // the next entry of the list of the thread
+	};
+
+	// The counters of the thread in the reverse order of their first use.
+	inline stats*& thread_stats_list() noexcept {
+		static thread_local stats* head = nullptr;
+		return head;
+	}
+
+	// Calls fn(const crc::stats&) for every CRC algorithm and mode used by
+	// the calling thread. The counters are thread-local so each thread has
+	// to export its own (e.g. periodically from its event loop).
+	template <typename FN>
+	void for_each_thread_stats(const FN& fn) {
+		for (const stats* s=thread_stats_list(); s; s=s->next)
+			fn(*s);
+	}
+
+	// Zeros the counters of the calling thread.
+	inline void reset_thread_stats() noexcept {
+		for (stats* s=thread_stats_list(); s; s=s->next) {
+			s->calls = s->bytes = s->nanoseconds = 0;
+			for (int i=0; i<STATS_HISTOGRAM_BUCKETS; i++)
+				s->size_histogram[i] = 0;
+		}
+	}
+
+	inline uint64 stats_clock() noexcept {
+#ifdef PARAMETRIC_CRC_STATS_TIMING
+		return uint64(std::chrono::duration_cast<std::chrono::nanoseconds>(
+			std::chrono::steady_clock::now().time_since_epoch()).count());
+#else
+		return 0;
+#endif
+	}
+
+	// The mode names of the stats. User defined updaters are "custom".
+	template <typename UPDATER>
+	struct updater_stats_info { static const char* mode() noexcept { return "custom"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_tableless<TBL_CFG>> { static const char* mode() noexcept { return "tableless"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_tableless_fast<TBL_CFG>> { static const char* mode() noexcept { return "tableless_fast"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_table_based<TBL_CFG>> { static const char* mode() noexcept { return "table_based"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_small_table_based<TBL_CFG>> { static const char* mode() noexcept { return "small_table_based"; } };
+	template <typename TBL_CFG, int N>
+	struct updater_stats_info<updater_sliced_table_based<TBL_CFG, N>> { static const char* mode() noexcept { return "sliced_table_based"; } };
+	template <typename TBL_CFG, int LANES>
+	struct updater_stats_info<updater_interleaved_table_based<TBL_CFG, LANES>> { static const char* mode() noexcept { return "interleaved_table_based"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_pre_reflected_table_based<TBL_CFG>> { static const char* mode() noexcept { return "pre_reflected_table_based"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_ext_table_based<TBL_CFG>> { static const char* mode() noexcept { return "ext_table_based"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_ext_small_table_based<TBL_CFG>> { static const char* mode() noexcept { return "ext_small_table_based"; } };
+	template <typename TBL_CFG, int N>
+	struct updater_stats_info<updater_ext_sliced_table_based<TBL_CFG, N>> { static const char* mode() noexcept { return "ext_sliced_table_based"; } };
+	template <typename TBL_CFG, int LANES>
+	struct updater_stats_info<updater_ext_interleaved_table_based<TBL_CFG, LANES>> { static const char* mode() noexcept { return "ext_interleaved_table_based"; } };
+	template <typename TBL_CFG>
+	struct updater_stats_info<updater_hw_accelerated<TBL_CFG>> {
+		static const char* mode() noexcept {
+			return engine_name(updater_hw_accelerated<TBL_CFG>::selected_engine());
+		}
+	};
+
+	// Records the calls of a CRC algorithm (CFG) and mode (UPDATER). The
+	// counters are registered in the list of the thread on their first use.
+	template <typename CFG, typename UPDATER>
+	class stats_recorder {
+		struct registered_stats {
+			stats s;
+			registered_stats() noexcept : s() {
+				s.width = CFG::WIDTH;
+				s.poly = CFG::POLY;
+				s.mode = updater_stats_info<UPDATER>::mode();
+				s.next = thread_stats_list();
+				thread_stats_list() = &s;
+			}
+		};
+
+	public:
+		static stats& counters() noexcept {
+			static thread_local registered_stats r;
+			return r.s;
+		}
+
+		static void record(size_t size, uint64 start_time) noexcept {
+			stats& s = counters();
+			s.calls++;
+			s.bytes += size;
+			int bucket = 0;
+			for (size_t n=size; n && bucket<STATS_HISTOGRAM_BUCKETS-1; n>>=1)
+				bucket++;
+			s.size_histogram[bucket]++;
+#ifdef PARAMETRIC_CRC_STATS_TIMING
+			s.nanoseconds += stats_clock() - start_time;
+#else
+			(void)start_time;
+#endif
+		}
+
+		// Records every message of a batch as a call. The time of the whole
+		// batch is added to the time of the last message.
+		template <typename MESSAGES>
+		static void record_batch(const MESSAGES& messages, size_t n, uint64 start_time) noexcept {
+			for (size_t i=0; i<n; i++) {
+				const uint8* p = nullptr;
+				size_t size = 0;
+				messages.get(i, p, size);
+				record(size, i+1 == n ? start_time : stats_clock());
+			}
+		}
+
+		template <typename UPDATE_FN, typename T>
+		static void update(const UPDATE_FN& update_fn, T& crc, const uint8* begin, const uint8* end) noexcept {
+			uint64 start_time = stats_clock();
+			update_fn(crc, begin, end);
+			record(size_t(end - begin), start_time);
+		}
+	};
+
+	// Wraps the UPDATE_FN of an impl or impl_ext class (see update_segments())
+	// to record the calls.
+	template <typename CFG, typename UPDATER, typename UPDATE_FN>
+	struct stats_update_fn {
+		UPDATE_FN update_fn;
+		explicit stats_update_fn(const UPDATE_FN& fn) noexcept : update_fn(fn) {}
+		void operator()(typename CFG::T& crc, const uint8* begin, const uint8* end) const noexcept {
+			stats_recorder<CFG, UPDATER>::update(update_fn, crc, begin, end);
+		}
+	};
+
+#else // PARAMETRIC_CRC_STATS
+
+	inline uint64 stats_clock() noexcept { return 0; }
+
+	template <typename CFG, typename UPDATER>
+	struct stats_recorder {
+		template <typename MESSAGES>
+		static void record_batch(const MESSAGES&, size_t, uint64) noexcept {}
+	};
+
+#endif // PARAMETRIC_CRC_STATS
+
+	// The size of the state written by the save_state() method of impl and
+	// impl_ext. The fields are little endian:
+	//     0: "CRC" and the format version (SAVED_STATE_VERSION)
+	//     4: WIDTH, flags (bit 0: REF_IN, bit 1: REF_OUT) and two zero bytes
+	//     8: POLY, INIT and XOR_OUT (8 bytes each)
+	//    32: the CRC register in unreflected form (8 bytes)
+	//    40: the byte offset passed to save_state() (8 bytes)
+	//    48: the CRC-32C of the first 48 bytes (4 bytes)
+	// Every mode folds its engine state (lanes, accumulators) back into the
+	// CRC register at the end of an update() call so the register is the
+	// whole state and it can be restored by any mode and REF_REG of the same
+	// algorithm (e.g. on another machine).
+	static constexpr size_t SAVED_STATE_SIZE = 52;
+	static constexpr uint8 SAVED_STATE_VERSION = 1;
+
+	template <typename CFG>
+	class state_serializer {
+		using T = typename CFG::T;
+		static constexpr uint8 FLAGS = (CFG::REF_IN ? 1 : 0) | (CFG::REF_OUT ? 2 : 0);
+
+		static constexpr void store(uint8* p, uint64 v, int size) noexcept {
+			for (int i=0; i<size; i++)
+				p[i] = uint8(v >> (8*i));
+		}
+
+		static constexpr uint32 checksum(const uint8* p) noexcept {
+			// CRC-32C (crc32::iscsi) with the reflected bit-by-bit algorithm
+			uint32 crc = 0xffffffff;
+			for (int i=0; i<48; i++)
+				core<32, true>::bbb_update(0x82f63b78, crc, p[i]);
+			return ~crc;
+		}
+
+		static constexpr void store_header(uint8* p) noexcept {
+			p[0] = 'C';
+			p[1] = 'R';
+			p[2] = 'C';
+			p[3] = SAVED_STATE_VERSION;
+			p[4] = uint8(CFG::WIDTH);
+			p[5] = FLAGS;
+			p[6] = 0;
+			p[7] = 0;
+			store(p + 8, CFG::POLY, 8);
+			store(p + 16, CFG::INIT, 8);
+			store(p + 24, CFG::XOR_OUT, 8);
+		}
+
+	public:
+		static constexpr void save(T crc, uint64 offset, uint8* out) noexcept {
+			store_header(out);
+			store(out + 32, conditional_reflect<T, CFG::REF_REG>::fn(crc), 8);
+			store(out + 40, offset, 8);
+			store(out + 48, checksum(out), 4);
+		}
+
+		static constexpr bool restore(const uint8* in, T& crc, uint64& offset) noexcept {
+			uint8 header[32] = {};
+			store_header(header);
+			for (int i=0; i<32; i++)
+				if (in[i] != header[i])
+					return false;
+			if (word_loader<uint32, true>::load(in + 48) != checksum(in))
+				return false;
+			uint64 reg = word_loader<uint64, true>::load(in + 32);
+			if (CFG::WIDTH < 64 && (reg >> (CFG::WIDTH % 64)))
+				return false;
+			crc = conditional_reflect<T, CFG::REF_REG>::fn(T(reg));
+			offset = word_loader<uint64, true>::load(in + 40);
+			return true;
+		}
 	};
 
+	template <bool CONDITION, typename TRUE_TYPE, typename FALSE_TYPE>
+	struct conditional_type { using type = TRUE_TYPE; };
+	template <typename TRUE_TYPE, typename FALSE_TYPE>
+	struct conditional_type<false, TRUE_TYPE, FALSE_TYPE> { using type = FALSE_TYPE; };
+
 	// In C++17 this could be solved with an "in-class explicit specialization"
 	// by adding a "template <bool REVERSE> void update()" method to the impl
 	// class with two specializations.
@@ -921,9 +3065,20 @@ namespace crc {
 	struct impl_input_reverser<UPDATER,T,true> : public UPDATER {
 		static constexpr void update(T& crc, const uint8* begin, const uint8* end) noexcept {
 			// this happens only when REF_IN != REF_REG
-			for (const uint8* p=begin; p<end; p++) {
-				uint8 b = reverse_bits(*p);
-				UPDATER::update(crc, &b, &b+1);
+			if (end - begin < REVERSED_INPUT_MIN_BLOCK_SIZE) {
+				for (const uint8* p=begin; p<end; p++) {
+					uint8 b = reverse_bits(*p);
+					UPDATER::update(crc, &b, &b+1);
+				}
+				return;
+			}
+			// The reversed input is passed to the updater in blocks so the
+			// block based code paths of the updater remain effective.
+			uint8 block[REVERSED_INPUT_BLOCK_SIZE] = {};
+			for (const uint8* p=begin; p<end; ) {
+				size_t n = reverse_input_block(p, end, block);
+				UPDATER::update(crc, block, block+n);
+				p += n;
 			}
 		}
 	};
@@ -945,12 +3100,34 @@ namespace crc {
 		using T = typename CFG::T;
 		T _crc;
 
+		using input_reverser = impl_input_reverser<UPDATER,T,
+			CFG::REF_IN!=CFG::REF_REG && !updater_reverses_input<UPDATER>::VALUE>;
+
+		struct update_fn {
+			void operator()(T& crc, const uint8* begin, const uint8* end) const noexcept {
+				input_reverser::update(crc, begin, end);
+			}
+		};
+
+#ifdef PARAMETRIC_CRC_STATS
+		using counted_update_fn = stats_update_fn<CFG, UPDATER, update_fn>;
+#else
+		using counted_update_fn = update_fn;
+#endif
+
 	public:
 		using value_type = T;
 		using table_type = typename UPDATER::table_type;
 
 		static constexpr T RESIDUE = residue_const_calculator<CFG>::RESIDUE;
 
+#ifdef PARAMETRIC_CRC_STATS
+		// The counters of this algorithm and mode on the calling thread.
+		static const stats& thread_stats() noexcept {
+			return stats_recorder<CFG, UPDATER>::counters();
+		}
+#endif
+
 		constexpr impl(T interim_remainder=CFG::ACTUAL_INIT) noexcept : _crc(interim_remainder) {}
 
 		// Returns the final CRC value. This value shouldn't be passed to the
@@ -970,8 +3147,28 @@ namespace crc {
 			return conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(_crc);
 		}
 
+		// Writes SAVED_STATE_SIZE bytes to out: the state of the calculation
+		// and the offset (e.g. the number of input bytes processed so far) for
+		// a checkpoint. The state can be restored by any mode of the algorithm.
+		constexpr void save_state(uint8* out, uint64 offset) const noexcept {
+			state_serializer<CFG>::save(_crc, offset, out);
+		}
+		constexpr void save_state(void* out, uint64 offset) const noexcept {
+			save_state((uint8*)out, offset);
+		}
+
+		// Restores the state written by save_state() and the offset. Returns
+		// false without changing anything if the state is corrupt or it belongs
+		// to a different algorithm or version.
+		constexpr bool restore_state(const uint8* in, uint64& offset) noexcept {
+			return state_serializer<CFG>::restore(in, _crc, offset);
+		}
+		constexpr bool restore_state(const void* in, uint64& offset) noexcept {
+			return restore_state((const uint8*)in, offset);
+		}
+
 		constexpr void update(uint8 b) noexcept {
-			impl_input_reverser<UPDATER,T,CFG::REF_IN!=CFG::REF_REG>::update(_crc, &b, &b+1);
+			update(&b, &b+1);
 		}
 		constexpr void update(int8 b) noexcept {
 			update(uint8(b));
@@ -988,7 +3185,13 @@ namespace crc {
 		// This limitation doesn't seem to apply to the byte based update above
 		// where casting between uint8/int8/char works for me without issues.
 		constexpr void update(const uint8* begin, const uint8* end) noexcept {
-			impl_input_reverser<UPDATER,T,CFG::REF_IN!=CFG::REF_REG>::update(_crc, begin, end);
+#ifdef PARAMETRIC_CRC_STATS
+			if (!PARAMETRIC_CRC_IS_CONSTANT_EVALUATED()) {
+				stats_recorder<CFG, UPDATER>::update(update_fn(), _crc, begin, end);
+				return;
+			}
+#endif
+			input_reverser::update(_crc, begin, end);
 		}
 		constexpr void update(const uint8* data, size_t size) noexcept {
 			update(data, data+size);
@@ -997,17 +3200,179 @@ namespace crc {
 			update((const uint8*)data, (const uint8*)data + size);
 		}
 
-		static constexpr T calculate(const uint8* begin, const uint8* end) noexcept {
-			impl crc;
-			crc.update(begin, end);
-			return crc.final();
+		// Updates the CRC with the concatenation of count buffers (e.g. the
+		// fragments of a network packet) in a single pass (see
+		// SEGMENT_STASH_SIZE). An array of struct iovec can be passed after a
+		// reinterpret_cast to const crc::segment*.
+		void update(const segment* segs, size_t count) noexcept {
+			update_segments(counted_update_fn(update_fn()), _crc, segs, count);
+		}
+
+		// Copies size bytes from src to dst (like memcpy() the buffers
+		// shouldn't overlap) and updates the CRC with them in a single pass.
+		// The _nt version writes dst with non-temporal stores on x86 that
+		// don't pollute the caches with the destination of a large copy.
+		void copy_and_update(void* dst, const void* src, size_t size) noexcept {
+			copy_and_update_blocks<false>(counted_update_fn(update_fn()), _crc, (uint8*)dst, (const uint8*)src, size);
+		}
+		void copy_and_update_nt(void* dst, const void* src, size_t size) noexcept {
+			copy_and_update_blocks<true>(counted_update_fn(update_fn()), _crc, (uint8*)dst, (const uint8*)src, size);
+		}
+
+		// Updates the CRC with the first bit_count bits of the data. The bits
+		// of a partial last byte are taken in the bit order of the algorithm
+		// (see partial_byte_updater). The whole bytes take the path of the
+		// mode and only the trailing bits are processed bit by bit.
+		constexpr void update_bits(const uint8* data, size_t bit_count) noexcept {
+			update(data, bit_count / 8);
+			if (bit_count % 8)
+				partial_byte_updater<CFG>::update(_crc, data[bit_count / 8], unsigned(bit_count % 8));
+		}
+		constexpr void update_bits(const void* data, size_t bit_count) noexcept {
+			update_bits((const uint8*)data, bit_count);
+		}
+
+		static constexpr T calculate(const uint8* begin, const uint8* end) noexcept {
+			impl crc;
+			crc.update(begin, end);
+			return crc.final();
+		}
+		static constexpr T calculate(const uint8* data, size_t size) noexcept {
+			return calculate(data, data+size);
+		}
+		static constexpr T calculate(const void* data, size_t size) noexcept {
+			return calculate((const uint8*)data, (const uint8*)data + size);
+		}
+
+		// Calculates the CRCs of n independent messages: out[i] is the same as
+		// calculate(ptrs[i], sizes[i]). Table-driven and tableless modes
+		// process several messages in lockstep (see batch_lanes).
+		static void calculate_batch(const void* const* ptrs, const size_t* sizes, T* out, size_t n) noexcept {
+			uint64 start_time = stats_clock();
+			batch_calculator<CFG, batch_lanes<UPDATER>::LANES>::calculate(
+				update_fn(), batch_messages{ptrs, sizes}, out, n);
+			stats_recorder<CFG, UPDATER>::record_batch(batch_messages{ptrs, sizes}, n, start_time);
+		}
+
+		// Same as the above with n messages of the same size placed at a fixed
+		// stride: out[i] is the same as calculate((const uint8*)data + i*stride, size).
+		static void calculate_batch(const void* data, size_t size, size_t stride, T* out, size_t n) noexcept {
+			uint64 start_time = stats_clock();
+			batch_calculator<CFG, batch_lanes<UPDATER>::LANES>::calculate(
+				update_fn(), strided_batch_messages{(const uint8*)data, size, stride}, out, n);
+			stats_recorder<CFG, UPDATER>::record_batch(
+				strided_batch_messages{(const uint8*)data, size, stride}, n, start_time);
+		}
+
+		// Returns true if the codeword (a message followed by its CRC) is
+		// error-free by comparing the CRC register with the residue constant.
+		// The CRC has to be appended in the byte order of the algorithm: little
+		// endian if REF_IN is true and big endian otherwise (with its bits
+		// reversed if REF_IN != REF_OUT, see residue_const_calculator).
+		static constexpr bool verify(const uint8* codeword, size_t size) noexcept {
+			impl crc;
+			crc.update(codeword, size);
+			return crc._crc == residue_const_calculator<CFG>::REGISTER_RESIDUE;
+		}
+		static constexpr bool verify(const void* codeword, size_t size) noexcept {
+			return verify((const uint8*)codeword, size);
+		}
+
+		// Checks n independent codewords in the same way as calculate_batch():
+		// valid[i] is the same as verify(ptrs[i], sizes[i]). Returns the number
+		// of error-free codewords.
+		static size_t verify_batch(const void* const* ptrs, const size_t* sizes, bool* valid, size_t n) noexcept {
+			return batch_verifier<CFG, batch_lanes<UPDATER>::LANES>::verify(
+				update_fn(), batch_messages{ptrs, sizes}, valid, n);
+		}
+
+		// Same as the above with n codewords of the same size placed at a fixed
+		// stride: valid[i] is the same as verify((const uint8*)data + i*stride, size).
+		static size_t verify_batch(const void* data, size_t size, size_t stride, bool* valid, size_t n) noexcept {
+			return batch_verifier<CFG, batch_lanes<UPDATER>::LANES>::verify(
+				update_fn(), strided_batch_messages{(const uint8*)data, size, stride}, valid, n);
+		}
+
+		// Updates the CRC as if size number of zero bytes were fed into it.
+		// It runs in O(log(size)) time and doesn't need a table.
+		constexpr void update_zeros(size_t size) noexcept {
+			combine_calculator<CFG>::zeros_update(_crc, size);
+		}
+
+		// Returns the final CRC of the concatenation of two chunks (A and B)
+		// of the input from the final CRC of A, the final CRC of B and the
+		// size of B. Both CRCs have to be calculated from the beginning (with
+		// the initial value of the register) like the output of calculate().
+		static constexpr T combine(T crc_a, T crc_b, size_t size_b) noexcept {
+			return combine_calculator<CFG>::combine(crc_a, crc_b, size_b);
+		}
+
+		// Same as combine() but works with interim remainders, the result can
+		// be passed to the constructor to continue the CRC calculation.
+		static constexpr T combine_interim(T interim_a, T interim_b, size_t size_b) noexcept {
+			return combine_calculator<CFG>::combine_interim(interim_a, interim_b, size_b);
+		}
+
+		// Returns the final CRC of a buffer of size bytes after overwriting
+		// its n bytes at offset (old_data) with new_data. The crc parameter
+		// is the final CRC of the buffer before the modification. It runs in
+		// O(n + log(size)) time. The modified bytes have to lie inside the
+		// buffer: offset + n <= size (checked with PARAMETRIC_CRC_ASSERT).
+		static T patch(T crc, size_t size, size_t offset, const void* old_data,
+				const void* new_data, size_t n) noexcept {
+			return combine_calculator<CFG>::patch(counted_update_fn(update_fn()), crc, size, offset,
+				(const uint8*)old_data, (const uint8*)new_data, n);
 		}
-		static constexpr T calculate(const uint8* data, size_t size) noexcept {
-			return calculate(data, data+size);
+
+		// Calculates the CRC of a large buffer in parallel. The buffer is split
+		// into at most max_tasks (and at most PARALLEL_MAX_TASKS) contiguous
+		// chunks of at least min_task_size bytes, the chunks are processed by
+		// the updater of this mode and their CRCs are combined with
+		// combine_interim(). Buffers that aren't large enough for two tasks are
+		// processed by calculate() without involving the executor.
+		//
+		// The executor is a callable: executor(num_tasks, task). It has to call
+		// task(i) for every i in the range [0..num_tasks) in any order and on
+		// any threads and it can return only after all of them have finished.
+		template <typename EXECUTOR>
+		static T parallel_calculate(const void* data, size_t size, EXECUTOR&& executor,
+				size_t max_tasks, size_t min_task_size=PARAMETRIC_CRC_PARALLEL_MIN_TASK_SIZE) {
+			const uint8* begin = (const uint8*)data;
+			size_t num_tasks = min_task_size ? size / min_task_size : size;
+			if (num_tasks > max_tasks)
+				num_tasks = max_tasks;
+			if (num_tasks > PARALLEL_MAX_TASKS)
+				num_tasks = PARALLEL_MAX_TASKS;
+			if (num_tasks < 2)
+				return calculate(begin, size);
+
+			// The last chunk receives the remainder of the division.
+			size_t chunk_size = size / num_tasks;
+			size_t last_chunk_size = size - (num_tasks - 1) * chunk_size;
+			T interims[PARALLEL_MAX_TASKS];
+			auto task = [begin, chunk_size, num_tasks, last_chunk_size, &interims](size_t i) {
+				const uint8* chunk = begin + i * chunk_size;
+				impl crc;
+				crc.update(chunk, chunk + (i+1 == num_tasks ? last_chunk_size : chunk_size));
+				interims[i] = crc.interim();
+			};
+			executor(num_tasks, task);
+
+			T crc = interims[0];
+			for (size_t i=1; i<num_tasks; i++)
+				crc = combine_interim(crc, interims[i], i+1 == num_tasks ? last_chunk_size : chunk_size);
+			return impl(crc).final();
 		}
-		static constexpr T calculate(const void* data, size_t size) noexcept {
-			return calculate((const uint8*)data, (const uint8*)data + size);
+
+#ifdef PARAMETRIC_CRC_THREADS
+		// parallel_calculate() with crc::thread_executor. Zero thread_count
+		// means std::thread::hardware_concurrency().
+		static T parallel_calculate(const void* data, size_t size, unsigned thread_count=0) {
+			if (!thread_count)
+				thread_count = std::thread::hardware_concurrency();
+			return parallel_calculate(data, size, thread_executor(), thread_count);
 		}
+#endif
 	};
 
 	// In C++17 this could be solved with an "in-class explicit specialization"
@@ -1029,9 +3394,18 @@ namespace crc {
 		static constexpr void update(T& crc, const uint8* begin, const uint8* end,
 				const typename UPDATER::table_type& table) noexcept {
 			// this happens only when REF_IN != REF_REG
-			for (const uint8* p=begin; p<end; p++) {
-				uint8 b = reverse_bits(*p);
-				UPDATER::update(crc, &b, &b+1, table);
+			if (end - begin < REVERSED_INPUT_MIN_BLOCK_SIZE) {
+				for (const uint8* p=begin; p<end; p++) {
+					uint8 b = reverse_bits(*p);
+					UPDATER::update(crc, &b, &b+1, table);
+				}
+				return;
+			}
+			uint8 block[REVERSED_INPUT_BLOCK_SIZE] = {};
+			for (const uint8* p=begin; p<end; ) {
+				size_t n = reverse_input_block(p, end, block);
+				UPDATER::update(crc, block, block+n, table);
+				p += n;
 			}
 		}
 	};
@@ -1044,12 +3418,35 @@ namespace crc {
 		using T = typename CFG::T;
 		T _crc;
 
+		using input_reverser = impl_ext_input_reverser<UPDATER,T,
+			CFG::REF_IN!=CFG::REF_REG && !updater_reverses_input<UPDATER>::VALUE>;
+
+		struct update_fn {
+			const typename UPDATER::table_type& table;
+			void operator()(T& crc, const uint8* begin, const uint8* end) const noexcept {
+				input_reverser::update(crc, begin, end, table);
+			}
+		};
+
+#ifdef PARAMETRIC_CRC_STATS
+		using counted_update_fn = stats_update_fn<CFG, UPDATER, update_fn>;
+#else
+		using counted_update_fn = update_fn;
+#endif
+
 	public:
 		using value_type = T;
 		using table_type = typename UPDATER::table_type;
 
 		static constexpr T RESIDUE = residue_const_calculator<CFG>::RESIDUE;
 
+#ifdef PARAMETRIC_CRC_STATS
+		// The counters of this algorithm and mode on the calling thread.
+		static const stats& thread_stats() noexcept {
+			return stats_recorder<CFG, UPDATER>::counters();
+		}
+#endif
+
 		constexpr impl_ext(T interim_remainder=CFG::ACTUAL_INIT) noexcept : _crc(interim_remainder) {}
 
 		// Returns the final CRC value. This value shouldn't be passed to the
@@ -1069,8 +3466,28 @@ namespace crc {
 			return conditional_reflect<T, CFG::REF_REG!=CFG::REF_OUT>::fn(_crc);
 		}
 
+		// Writes SAVED_STATE_SIZE bytes to out: the state of the calculation
+		// and the offset (e.g. the number of input bytes processed so far) for
+		// a checkpoint. The state can be restored by any mode of the algorithm.
+		constexpr void save_state(uint8* out, uint64 offset) const noexcept {
+			state_serializer<CFG>::save(_crc, offset, out);
+		}
+		constexpr void save_state(void* out, uint64 offset) const noexcept {
+			save_state((uint8*)out, offset);
+		}
+
+		// Restores the state written by save_state() and the offset. Returns
+		// false without changing anything if the state is corrupt or it belongs
+		// to a different algorithm or version.
+		constexpr bool restore_state(const uint8* in, uint64& offset) noexcept {
+			return state_serializer<CFG>::restore(in, _crc, offset);
+		}
+		constexpr bool restore_state(const void* in, uint64& offset) noexcept {
+			return restore_state((const uint8*)in, offset);
+		}
+
 		constexpr void update(uint8 b, const table_type& table) noexcept {
-			impl_ext_input_reverser<UPDATER,T,CFG::REF_IN!=CFG::REF_REG>::update(_crc, &b, &b+1, table);
+			update(&b, &b+1, table);
 		}
 		constexpr void update(int8 b, const table_type& table) noexcept {
 			update(uint8(b), table);
@@ -1080,7 +3497,13 @@ namespace crc {
 		}
 
 		constexpr void update(const uint8* begin, const uint8* end, const table_type& table) noexcept {
-			impl_ext_input_reverser<UPDATER,T,CFG::REF_IN!=CFG::REF_REG>::update(_crc, begin, end, table);
+#ifdef PARAMETRIC_CRC_STATS
+			if (!PARAMETRIC_CRC_IS_CONSTANT_EVALUATED()) {
+				stats_recorder<CFG, UPDATER>::update(update_fn{table}, _crc, begin, end);
+				return;
+			}
+#endif
+			input_reverser::update(_crc, begin, end, table);
 		}
 		constexpr void update(const uint8* data, size_t size, const table_type& table) noexcept {
 			update(data, data+size, table);
@@ -1089,6 +3512,36 @@ namespace crc {
 			update((const uint8*)data, (const uint8*)data + size, table);
 		}
 
+		// Updates the CRC with the concatenation of count buffers (e.g. the
+		// fragments of a network packet) in a single pass (see
+		// SEGMENT_STASH_SIZE). An array of struct iovec can be passed after a
+		// reinterpret_cast to const crc::segment*.
+		void update(const segment* segs, size_t count, const table_type& table) noexcept {
+			update_segments(counted_update_fn(update_fn{table}), _crc, segs, count);
+		}
+
+		// Copies size bytes from src to dst and updates the CRC with them in a
+		// single pass (see impl::copy_and_update()).
+		void copy_and_update(void* dst, const void* src, size_t size, const table_type& table) noexcept {
+			copy_and_update_blocks<false>(counted_update_fn(update_fn{table}), _crc, (uint8*)dst, (const uint8*)src, size);
+		}
+		void copy_and_update_nt(void* dst, const void* src, size_t size, const table_type& table) noexcept {
+			copy_and_update_blocks<true>(counted_update_fn(update_fn{table}), _crc, (uint8*)dst, (const uint8*)src, size);
+		}
+
+		// Updates the CRC with the first bit_count bits of the data. The bits
+		// of a partial last byte are taken in the bit order of the algorithm
+		// (see partial_byte_updater). The whole bytes take the path of the
+		// mode and only the trailing bits are processed bit by bit.
+		constexpr void update_bits(const uint8* data, size_t bit_count, const table_type& table) noexcept {
+			update(data, bit_count / 8, table);
+			if (bit_count % 8)
+				partial_byte_updater<CFG>::update(_crc, data[bit_count / 8], unsigned(bit_count % 8));
+		}
+		constexpr void update_bits(const void* data, size_t bit_count, const table_type& table) noexcept {
+			update_bits((const uint8*)data, bit_count, table);
+		}
+
 		static constexpr T calculate(const uint8* begin, const uint8* end, const table_type& table) noexcept {
 			impl_ext crc;
 			crc.update(begin, end, table);
@@ -1100,6 +3553,85 @@ namespace crc {
 		static constexpr T calculate(const void* data, size_t size, const table_type& table) noexcept {
 			return calculate((const uint8*)data, (const uint8*)data + size, table);
 		}
+
+		// Calculates the CRCs of n independent messages: out[i] is the same as
+		// calculate(ptrs[i], sizes[i], table). Table-driven and tableless modes
+		// process several messages in lockstep (see batch_lanes).
+		static void calculate_batch(const void* const* ptrs, const size_t* sizes, T* out, size_t n,
+				const table_type& table) noexcept {
+			uint64 start_time = stats_clock();
+			batch_calculator<CFG, batch_lanes<UPDATER>::LANES>::calculate(
+				update_fn{table}, batch_messages{ptrs, sizes}, out, n);
+			stats_recorder<CFG, UPDATER>::record_batch(batch_messages{ptrs, sizes}, n, start_time);
+		}
+
+		// Same as the above with n messages of the same size placed at a fixed stride:
+		// out[i] is the same as calculate((const uint8*)data + i*stride, size, table).
+		static void calculate_batch(const void* data, size_t size, size_t stride, T* out, size_t n,
+				const table_type& table) noexcept {
+			uint64 start_time = stats_clock();
+			batch_calculator<CFG, batch_lanes<UPDATER>::LANES>::calculate(
+				update_fn{table}, strided_batch_messages{(const uint8*)data, size, stride}, out, n);
+			stats_recorder<CFG, UPDATER>::record_batch(
+				strided_batch_messages{(const uint8*)data, size, stride}, n, start_time);
+		}
+
+		// Returns true if the codeword (a message followed by its CRC) is
+		// error-free (see impl::verify()).
+		static constexpr bool verify(const uint8* codeword, size_t size, const table_type& table) noexcept {
+			impl_ext crc;
+			crc.update(codeword, size, table);
+			return crc._crc == residue_const_calculator<CFG>::REGISTER_RESIDUE;
+		}
+		static constexpr bool verify(const void* codeword, size_t size, const table_type& table) noexcept {
+			return verify((const uint8*)codeword, size, table);
+		}
+
+		// Checks n independent codewords: valid[i] is the same as
+		// verify(ptrs[i], sizes[i], table). Returns the number of error-free codewords.
+		static size_t verify_batch(const void* const* ptrs, const size_t* sizes, bool* valid, size_t n,
+				const table_type& table) noexcept {
+			return batch_verifier<CFG, batch_lanes<UPDATER>::LANES>::verify(
+				update_fn{table}, batch_messages{ptrs, sizes}, valid, n);
+		}
+
+		// Same as the above with n codewords of the same size placed at a fixed stride.
+		static size_t verify_batch(const void* data, size_t size, size_t stride, bool* valid, size_t n,
+				const table_type& table) noexcept {
+			return batch_verifier<CFG, batch_lanes<UPDATER>::LANES>::verify(
+				update_fn{table}, strided_batch_messages{(const uint8*)data, size, stride}, valid, n);
+		}
+
+		// Updates the CRC as if size number of zero bytes were fed into it.
+		// It runs in O(log(size)) time and doesn't need a table.
+		constexpr void update_zeros(size_t size) noexcept {
+			combine_calculator<CFG>::zeros_update(_crc, size);
+		}
+
+		// Returns the final CRC of the concatenation of two chunks (A and B)
+		// of the input from the final CRC of A, the final CRC of B and the
+		// size of B. Both CRCs have to be calculated from the beginning (with
+		// the initial value of the register) like the output of calculate().
+		static constexpr T combine(T crc_a, T crc_b, size_t size_b) noexcept {
+			return combine_calculator<CFG>::combine(crc_a, crc_b, size_b);
+		}
+
+		// Same as combine() but works with interim remainders, the result can
+		// be passed to the constructor to continue the CRC calculation.
+		static constexpr T combine_interim(T interim_a, T interim_b, size_t size_b) noexcept {
+			return combine_calculator<CFG>::combine_interim(interim_a, interim_b, size_b);
+		}
+
+		// Returns the final CRC of a buffer of size bytes after overwriting
+		// its n bytes at offset (old_data) with new_data. The crc parameter
+		// is the final CRC of the buffer before the modification. It runs in
+		// O(n + log(size)) time. The modified bytes have to lie inside the
+		// buffer: offset + n <= size (checked with PARAMETRIC_CRC_ASSERT).
+		static T patch(T crc, size_t size, size_t offset, const void* old_data,
+				const void* new_data, size_t n, const table_type& table) noexcept {
+			return combine_calculator<CFG>::patch(counted_update_fn(update_fn{table}), crc, size, offset,
+				(const uint8*)old_data, (const uint8*)new_data, n);
+		}
 	};
 
 	template <
@@ -1109,7 +3641,7 @@ namespace crc {
 		uint<WIDTH_> XOR_OUT_,
 		bool REF_IN_,           // reflected input
 		bool REF_OUT_=REF_IN_,  // reflected output
-		bool REF_REG_=REF_IN_   // reflected CRC shift register and table entries
+		bool REF_REG_=PARAMETRIC_CRC_DEFAULT_REF_REG(REF_IN_)  // reflected CRC shift register and table entries
 	>
 	class parametric : public impl< // the implementation of the "table_based" mode
 			cfg<WIDTH_, POLY_, INIT_, XOR_OUT_, REF_IN_, REF_OUT_, REF_REG_>,
@@ -1127,7 +3659,783 @@ namespace crc {
 		using ext_table_based       = impl_ext<CFG, updater_ext_table_based<typename CFG::TBL_CFG>>;
 		using ext_small_table_based = impl_ext<CFG, updater_ext_small_table_based<typename CFG::TBL_CFG>>;
 		using tableless             = impl<CFG, updater_tableless<typename CFG::TBL_CFG>>;
+		using tableless_fast        = impl<CFG, updater_tableless_fast<typename CFG::TBL_CFG>>;
+
+		// N is the number of bytes processed per iteration (8 or 16)
+		template <int N>
+		using sliced_table_based     = impl<CFG, updater_sliced_table_based<typename CFG::TBL_CFG, N>>;
+		template <int N>
+		using ext_sliced_table_based = impl_ext<CFG, updater_ext_sliced_table_based<typename CFG::TBL_CFG, N>>;
+
+		// LANES is the number of independent CRC registers (2..4 is the sweet spot)
+		template <int LANES>
+		using interleaved_table_based     = impl<CFG, updater_interleaved_table_based<typename CFG::TBL_CFG, LANES>>;
+		template <int LANES>
+		using ext_interleaved_table_based = impl_ext<CFG, updater_ext_interleaved_table_based<typename CFG::TBL_CFG, LANES>>;
+
+		using hw_accelerated        = impl<CFG, updater_hw_accelerated<typename CFG::TBL_CFG>>;
+
+		// Same as table_based if REF_IN == REF_REG. Otherwise it uses its own
+		// table that doesn't require the bit reversal of the input bytes.
+		using pre_reflected_table_based = typename conditional_type<CFG::REF_IN != CFG::REF_REG,
+			impl<CFG, updater_pre_reflected_table_based<typename CFG::TBL_CFG>>,
+			impl<CFG, updater_table_based<typename CFG::TBL_CFG>>>::type;
+
+		// Hashing of fixed size keys (e.g. in hash tables): the result is the
+		// same as calculate(key, N) but the table lookups are unrolled at
+		// compile time and the CRC instruction of the CPU is used at runtime
+		// when available (e.g. crc32::castagnoli with SSE4.2 or on ARMv8).
+		template <size_t N>
+		static constexpr value_type hash_fixed(const uint8* key) noexcept {
+			return fixed_size_hasher<CFG, N>::hash(key);
+		}
+		template <size_t N>
+		static value_type hash_fixed(const void* key) noexcept {
+			return fixed_size_hasher<CFG, N>::hash((const uint8*)key);
+		}
+
+		// The bytes of the key are hashed in little endian order: the result
+		// is the same as calculate(&key, sizeof(key)) on little endian CPUs.
+		static constexpr value_type hash_u32(uint32 key) noexcept {
+			const uint8 bytes[4] = { uint8(key), uint8(key >> 8), uint8(key >> 16), uint8(key >> 24) };
+			return hash_fixed<4>(bytes);
+		}
+		static constexpr value_type hash_u64(uint64 key) noexcept {
+			const uint8 bytes[8] = { uint8(key), uint8(key >> 8), uint8(key >> 16), uint8(key >> 24),
+				uint8(key >> 32), uint8(key >> 40), uint8(key >> 48), uint8(key >> 56) };
+			return hash_fixed<8>(bytes);
+		}
+	};
+
+	// A std::hash compatible function object that hashes the object
+	// representation of the key with parametric::hash_fixed(). The KEY type
+	// shouldn't have padding bytes (integers, pointers, packed structs):
+	//
+	//    std::unordered_map<uint64_t, V, crc::hasher<crc32::castagnoli, uint64_t>> map;
+	template <typename CRC, typename KEY>
+	struct hasher {
+		size_t operator()(const KEY& key) const noexcept {
+			return size_t(CRC::template hash_fixed<sizeof(KEY)>((const void*)&key));
+		}
+	};
+
+	template <typename... TYPES>
+	struct type_list {};
+
+	template <typename A, typename B>
+	struct is_same_type { static constexpr bool VALUE = false; };
+	template <typename A>
+	struct is_same_type<A, A> { static constexpr bool VALUE = true; };
+
+	template <typename LIST, typename T>
+	struct type_list_contains;
+	template <typename T>
+	struct type_list_contains<type_list<>, T> { static constexpr bool VALUE = false; };
+	template <typename HEAD, typename... TAIL, typename T>
+	struct type_list_contains<type_list<HEAD, TAIL...>, T> {
+		static constexpr bool VALUE = is_same_type<HEAD, T>::VALUE ||
+			type_list_contains<type_list<TAIL...>, T>::VALUE;
+	};
+
+	// Appends the table type to the list of distinct table types.
+	template <typename LIST, typename TABLE, bool SKIP=type_list_contains<LIST, TABLE>::VALUE>
+	struct table_list_add { using type = LIST; };
+	template <typename... TABLES, typename TABLE>
+	struct table_list_add<type_list<TABLES...>, TABLE, false> { using type = type_list<TABLES..., TABLE>; };
+	template <typename... TABLES>
+	struct table_list_add<type_list<TABLES...>, void, false> { using type = type_list<TABLES...>; };
+
+	template <typename LIST, typename... CRCS>
+	struct table_list_builder { using type = LIST; };
+	template <typename LIST, typename CRC, typename... CRCS>
+	struct table_list_builder<LIST, CRC, CRCS...> {
+		using type = typename table_list_builder<
+			typename table_list_add<LIST, typename CRC::table_type>::type, CRCS...>::type;
+	};
+
+	// The PAYLOAD_BYTES of a table type: the size of its entries without the
+	// alignment padding. Table types without PAYLOAD_BYTES (e.g. the tables
+	// of user defined updaters) are assumed to have no padding.
+	template <typename TABLE, typename=void>
+	struct table_payload_bytes { static constexpr size_t BYTES = sizeof(TABLE); };
+	template <typename TABLE>
+	struct table_payload_bytes<TABLE, decltype(void(TABLE::PAYLOAD_BYTES))> {
+		static constexpr size_t BYTES = TABLE::PAYLOAD_BYTES;
+	};
+
+	template <typename LIST>
+	struct table_list_bytes;
+	template <typename... TABLES>
+	struct table_list_bytes<type_list<TABLES...>> {
+		static constexpr size_t sum() noexcept {
+			size_t sizes[] = { 0, sizeof(TABLES)... };
+			size_t bytes = 0;
+			for (size_t size : sizes)
+				bytes += size;
+			return bytes;
+		}
+		static constexpr size_t payload_sum() noexcept {
+			size_t sizes[] = { 0, table_payload_bytes<TABLES>::BYTES... };
+			size_t bytes = 0;
+			for (size_t size : sizes)
+				bytes += size;
+			return bytes;
+		}
+		static constexpr size_t NUM_TABLES = sizeof...(TABLES);
+		static constexpr size_t BYTES = sum();
+		static constexpr size_t PAYLOAD_BYTES = payload_sum();
+	};
+
+	// Compile time report of the lookup tables used by a set of CRC classes
+	// (any mode of any algorithm). The tables are identified by their type:
+	// two CRC classes with the same table type share the same static_table<>
+	// instance (e.g. crc16::kermit and crc16::kermit::hw_accelerated or two
+	// algorithms with the same POLY and REF_REG). The ext modes contribute
+	// the table type they expect from the user. TABLE_BYTES is the memory
+	// occupied by the tables (their sizeof), PAYLOAD_BYTES is the size of
+	// their entries and PADDING_BYTES is the difference: the alignment
+	// padding (see PARAMETRIC_CRC_TABLE_ALIGNMENT). The tables of the library
+	// have no padding with the natural alignment and with 64.
+	//
+	//    using usage = crc::table_usage<crc16::kermit, crc16::xmodem, crc32::iscsi>;
+	//    static_assert(usage::NUM_TABLES == 3, "");
+	//    printf("%d bytes\n", int(usage::TABLE_BYTES));  // 512+512+1024
+	template <typename... CRCS>
+	struct table_usage {
+		// type_list<> of the distinct table types
+		using tables = typename table_list_builder<type_list<>, CRCS...>::type;
+		static constexpr size_t NUM_TABLES = table_list_bytes<tables>::NUM_TABLES;
+		static constexpr size_t TABLE_BYTES = table_list_bytes<tables>::BYTES;
+		static constexpr size_t PAYLOAD_BYTES = table_list_bytes<tables>::PAYLOAD_BYTES;
+		static constexpr size_t PADDING_BYTES = TABLE_BYTES - PAYLOAD_BYTES;
+	};
+
+	// crc::multi walks its input in blocks of this many bytes: every
+	// algorithm processes a block while it is in the L1 cache.
+	static constexpr size_t MULTI_BLOCK_SIZE = 8192;
+
+	// The CRC objects of crc::multi in a recursive list.
+	template <typename... CRCS>
+	struct multi_members {
+		constexpr void update(const uint8*, const uint8*) noexcept {}
+	};
+	template <typename CRC, typename... CRCS>
+	struct multi_members<CRC, CRCS...> {
+		CRC head;
+		multi_members<CRCS...> tail;
+
+		constexpr void update(const uint8* begin, const uint8* end) noexcept {
+			head.update(begin, end);
+			tail.update(begin, end);
+		}
+	};
+
+	template <size_t I>
+	struct multi_member_getter {
+		template <typename MEMBERS>
+		static constexpr auto& get(MEMBERS& m) noexcept { return multi_member_getter<I-1>::get(m.tail); }
+	};
+	template <>
+	struct multi_member_getter<0> {
+		template <typename MEMBERS>
+		static constexpr auto& get(MEMBERS& m) noexcept { return m.head; }
+	};
+
+	// Calculates the CRCs of several algorithms in a single pass over memory.
+	// The CRCS can be any mode of any algorithm except the ext modes (e.g.
+	// crc32::iso_hdlc::hw_accelerated and crc64::xz). The pass is per cache
+	// block: the input is split into blocks of MULTI_BLOCK_SIZE bytes and the
+	// algorithms process each block one after the other while it is in the L1
+	// cache, so a buffer larger than the cache is read from memory only once.
+	// The algorithms aren't interleaved per byte or word: each of them keeps
+	// using the fastest code path of its mode (e.g. CLMUL folding), which
+	// would be impossible within a common loop.
+	//
+	//    crc::multi<crc32::iso_hdlc, crc64::xz> crcs;
+	//    crcs.update(data, size);
+	//    uint32_t zip_crc = crcs.final<0>();
+	//    uint64_t xz_crc = crcs.final<1>();
+	template <typename... CRCS>
+	class multi {
+		multi_members<CRCS...> _members;
+
+	public:
+		static constexpr size_t SIZE = sizeof...(CRCS);
+
+		constexpr multi() noexcept : _members() {}
+
+		constexpr void update(const uint8* begin, const uint8* end) noexcept {
+			for (; size_t(end - begin) > MULTI_BLOCK_SIZE; begin += MULTI_BLOCK_SIZE)
+				_members.update(begin, begin + MULTI_BLOCK_SIZE);
+			_members.update(begin, end);
+		}
+		constexpr void update(const uint8* data, size_t size) noexcept {
+			update(data, data+size);
+		}
+		constexpr void update(const void* data, size_t size) noexcept {
+			update((const uint8*)data, (const uint8*)data + size);
+		}
+
+		// The CRC object of the I-th algorithm (e.g. for its interim()).
+		template <size_t I>
+		constexpr auto& get() noexcept {
+			static_assert(I < SIZE, "crc::multi index out of range");
+			return multi_member_getter<I>::get(_members);
+		}
+		template <size_t I>
+		constexpr const auto& get() const noexcept {
+			static_assert(I < SIZE, "crc::multi index out of range");
+			return multi_member_getter<I>::get(_members);
+		}
+
+		// The final CRC of the I-th algorithm.
+		template <size_t I>
+		constexpr auto final() const noexcept {
+			return get<I>().final();
+		}
+	};
+
+#ifdef PARAMETRIC_CRC_TABLE_ALLOCATION
+	// Generates a table of TABLE_TYPE (e.g. crc32::iscsi::ext_table_based::table_type)
+	// in the memory returned by allocator.allocate(size, alignment) and
+	// returns nullptr if the allocation fails. The allocator can place the
+	// table in a huge page or in a NUMA-local arena. The tables are
+	// trivially destructible: the memory can be released without a
+	// destructor call.
+	template <typename TABLE_TYPE, typename ALLOCATOR>
+	TABLE_TYPE* create_table(ALLOCATOR& allocator) noexcept {
+		void* p = allocator.allocate(sizeof(TABLE_TYPE), alignof(TABLE_TYPE));
+		if (!p)
+			return nullptr;
+		TABLE_TYPE* table = new (p) TABLE_TYPE(UNINITIALIZED);
+		table->generate();
+		return table;
+	}
+
+	// The maximum number of NUMA nodes of crc::table_replicas.
+	static constexpr int TABLE_REPLICAS_MAX_NODES = 16;
+
+	// One copy of a table per NUMA node so the threads don't read the table
+	// from the memory of another CPU socket. The allocator is an object with
+	// the following methods:
+	//    void* allocate(int node, size_t size, size_t alignment)  // e.g. numa_alloc_onnode()
+	//    void deallocate(int node, void* p, size_t size)
+	// The replicas are generated on the calling thread (the first write of a
+	// page decides its node only with first-touch allocators so those have to
+	// bind the memory to the node explicitly, e.g. with mbind()). Nodes that
+	// fail to allocate use the replica of node 0 (or the static constexpr
+	// instance of the table if node 0 fails too).
+	//
+	//    crc::table_replicas<crc32::iscsi::ext_table_based::table_type, numa_allocator>
+	//        tables(numa_num_configured_nodes(), allocator);
+	//    crc32::iscsi::ext_table_based::calculate(data, size, tables.get(numa_node_of_cpu(cpu)));
+	template <typename TABLE_TYPE, typename ALLOCATOR>
+	class table_replicas {
+		struct node_allocator {
+			ALLOCATOR& allocator;
+			int node;
+			void* allocate(size_t size, size_t alignment) {
+				return allocator.allocate(node, size, alignment);
+			}
+		};
+
+		ALLOCATOR& _allocator;
+		int _num_nodes;
+		TABLE_TYPE* _tables[TABLE_REPLICAS_MAX_NODES];
+
+	public:
+		table_replicas(int num_nodes, ALLOCATOR& allocator) noexcept : _allocator(allocator),
+				_num_nodes(num_nodes < 1 ? 1 : num_nodes > TABLE_REPLICAS_MAX_NODES ?
+					TABLE_REPLICAS_MAX_NODES : num_nodes),
+				_tables() {
+			for (int node=0; node<_num_nodes; node++) {
+				node_allocator a{_allocator, node};
+				_tables[node] = create_table<TABLE_TYPE>(a);
+			}
+		}
+		table_replicas(const table_replicas&) = delete;
+		table_replicas& operator=(const table_replicas&) = delete;
+
+		~table_replicas() {
+			for (int node=0; node<_num_nodes; node++)
+				if (_tables[node])
+					_allocator.deallocate(node, _tables[node], sizeof(TABLE_TYPE));
+		}
+
+		int num_nodes() const noexcept {
+			return _num_nodes;
+		}
+
+		// Returns the replica of the node. The node doesn't have to be exact:
+		// replicas are identical and out of range nodes get the table of node 0.
+		const TABLE_TYPE& get(int node) const noexcept {
+			if (node >= 0 && node < _num_nodes && _tables[node])
+				return *_tables[node];
+			return _tables[0] ? *_tables[0] : static_table<TABLE_TYPE>::instance;
+		}
+
+		// Tells whether the replica of the node is in the memory returned by
+		// allocate() for that node.
+		bool is_local(int node) const noexcept {
+			return node >= 0 && node < _num_nodes && _tables[node];
+		}
+	};
+#endif // PARAMETRIC_CRC_TABLE_ALLOCATION
+
+#ifdef PARAMETRIC_CRC_DYNAMIC
+	// The parameters of a CRC algorithm for crc::dynamic. The meaning of the
+	// fields is the same as that of the template parameters of crc::parametric.
+	// The width has to be 8, 16, 32 or 64 and the values are unreflected.
+	struct dynamic_cfg {
+		int width;
+		uint64 poly;
+		uint64 init;
+		uint64 xor_out;
+		bool ref_in;
+		bool ref_out;
+		bool ref_reg;
+	};
+
+	// A lookup table of crc::dynamic. The entries array of the width is used.
+	struct dynamic_table {
+		// cache key (width==0: empty slot)
+		int width;
+		uint64 poly;
+		bool ref_reg;
+
+		unsigned refcount;
+		uint64 last_use;
+		// false while the acquire() call that reserved the slot generates the
+		// entries outside the lock of the cache
+		std::atomic<bool> ready;
+
+		union {
+			alignas(table_alignment<uint8>::VALUE) uint8 entries8[256];
+			uint16 entries16[256];
+			uint32 entries32[256];
+			uint64 entries64[256];
+		};
+	};
+
+	template <int WIDTH> struct dynamic_table_entries;
+	template <> struct dynamic_table_entries<8>  { static uint8*  get(dynamic_table& t) noexcept { return t.entries8; } };
+	template <> struct dynamic_table_entries<16> { static uint16* get(dynamic_table& t) noexcept { return t.entries16; } };
+	template <> struct dynamic_table_entries<32> { static uint32* get(dynamic_table& t) noexcept { return t.entries32; } };
+	template <> struct dynamic_table_entries<64> { static uint64* get(dynamic_table& t) noexcept { return t.entries64; } };
+
+	// The implementation of crc::dynamic for a given width and register
+	// orientation on top of core<>. The CRC register is stored in a uint64.
+	template <int WIDTH, bool REF_REG>
+	struct dynamic_engine {
+		using T = uint<WIDTH>;
+		using core_type = core<WIDTH, REF_REG>;
+
+		static void generate(dynamic_table& table) noexcept {
+			core_type::generate_table(T(table.poly), dynamic_table_entries<WIDTH>::get(table));
+		}
+
+		static void table_based_update(dynamic_table* table, uint64 poly, uint64& crc,
+				const uint8* begin, const uint8* end) noexcept {
+			(void)poly;
+			T c = T(crc);
+			core_type::table_based_update(c, begin, end, dynamic_table_entries<WIDTH>::get(*table));
+			crc = c;
+		}
+
+		static void tableless_update(dynamic_table*, uint64 poly, uint64& crc,
+				const uint8* begin, const uint8* end) noexcept {
+			T c = T(crc);
+			if (size_t(end - begin) < TABLELESS_FAST_MIN_SIZE)
+				core_type::tableless_update(T(poly), c, begin, end);
+			else
+				core_type::tableless_fast_update(T(poly), c, begin, end);
+			crc = c;
+		}
+
+		static uint64 reflect(uint64 v) noexcept {
+			return reverse_bits(T(v));
+		}
+	};
+
+	// Spinlock on a std::atomic_flag. The critical sections of the
+	// dynamic_table_cache are short (a lookup in the slots without the
+	// generation of the table) and it doesn't depend on PARAMETRIC_CRC_THREADS
+	// and <mutex>.
+	class spin_lock {
+		std::atomic_flag _flag = ATOMIC_FLAG_INIT;
+
+	public:
+		spin_lock() noexcept = default;
+		spin_lock(const spin_lock&) = delete;
+		spin_lock& operator=(const spin_lock&) = delete;
+
+		void lock() noexcept {
+			while (_flag.test_and_set(std::memory_order_acquire)) {}
+		}
+		void unlock() noexcept {
+			_flag.clear(std::memory_order_release);
+		}
+	};
+
+	class spin_lock_guard {
+		spin_lock& _lock;
+
+	public:
+		explicit spin_lock_guard(spin_lock& lock) noexcept : _lock(lock) { _lock.lock(); }
+		~spin_lock_guard() { _lock.unlock(); }
+		spin_lock_guard(const spin_lock_guard&) = delete;
+		spin_lock_guard& operator=(const spin_lock_guard&) = delete;
+	};
+
+	// LRU cache of the lookup tables of crc::dynamic keyed by (width, poly,
+	// ref_reg). Tables referenced by crc::dynamic instances aren't evicted.
+	// If all slots are in use then acquire() returns nullptr and the
+	// crc::dynamic instance falls back to tableless calculation. The cache is
+	// shared by all threads and its methods are always thread-safe.
+	class dynamic_table_cache {
+		dynamic_table _slots[PARAMETRIC_CRC_DYNAMIC_CACHE_SIZE];
+		uint64 _clock;
+		spin_lock _lock;
+
+	public:
+		dynamic_table_cache() noexcept : _slots(), _clock() {}
+		dynamic_table_cache(const dynamic_table_cache&) = delete;
+		dynamic_table_cache& operator=(const dynamic_table_cache&) = delete;
+
+		static dynamic_table_cache& instance() noexcept {
+			static dynamic_table_cache cache;
+			return cache;
+		}
+
+		// The slot of a new table is reserved under the lock and its entries
+		// are generated after releasing it. Other threads that acquire the
+		// same table in the meantime wait until it is ready. A slot can't be
+		// evicted during the generation because the generating thread holds
+		// a reference to it.
+		dynamic_table* acquire(int width, uint64 poly, bool ref_reg,
+				void (*generate)(dynamic_table&)) noexcept {
+			dynamic_table* table = nullptr;
+			bool reserved = false;
+			{
+				spin_lock_guard guard(_lock);
+				dynamic_table* victim = nullptr;
+				for (dynamic_table& t : _slots) {
+					if (t.width == width && t.poly == poly && t.ref_reg == ref_reg) {
+						t.refcount++;
+						t.last_use = ++_clock;
+						table = &t;
+						break;
+					}
+					if (!t.refcount && (!victim || t.last_use < victim->last_use))
+						victim = &t;
+				}
+				if (!table) {
+					if (!victim)
+						return nullptr;
+					victim->width = width;
+					victim->poly = poly;
+					victim->ref_reg = ref_reg;
+					victim->refcount = 1;
+					victim->last_use = ++_clock;
+					victim->ready.store(false, std::memory_order_relaxed);
+					table = victim;
+					reserved = true;
+				}
+			}
+			if (reserved) {
+				generate(*table);
+				table->ready.store(true, std::memory_order_release);
+			}
+			else {
+				while (!table->ready.load(std::memory_order_acquire)) {}
+			}
+			return table;
+		}
+
+		void add_ref(dynamic_table* table) noexcept {
+			spin_lock_guard guard(_lock);
+			table->refcount++;
+		}
+
+		void release(dynamic_table* table) noexcept {
+			spin_lock_guard guard(_lock);
+			table->refcount--;
+		}
+	};
+
+	// CRC calculator with runtime parameters. The lookup table is shared
+	// with the other instances that have the same width, poly and ref_reg
+	// through the dynamic_table_cache so only the first instance pays for
+	// its generation. Unlike the rest of the library this class isn't
+	// constexpr and it is slower than the template based modes because its
+	// update() goes through a function pointer, but it runs at table speed.
+	//
+	//    crc::dynamic_cfg cfg = { 16, 0x1021, 0x0000, 0x0000, true, true, true };
+	//    crc::dynamic crc_obj(cfg);
+	//    crc_obj.update("123456789", 9);
+	//    printf("CRC-16/KERMIT check=0x%04x\n", unsigned(crc_obj.final()));
+	class dynamic {
+		using update_fn = void (*)(dynamic_table* table, uint64 poly, uint64& crc,
+			const uint8* begin, const uint8* end);
+		using generate_fn = void (*)(dynamic_table& table);
+		using reflect_fn = uint64 (*)(uint64 v);
+
+		dynamic_cfg _cfg;
+		uint64 _mask;
+		uint64 _actual_init;
+		uint64 _actual_poly;
+		uint64 _crc;
+		dynamic_table* _table;
+		update_fn _update;
+		reflect_fn _reflect;
+
+		template <int WIDTH, bool REF_REG>
+		void bind() noexcept {
+			using engine = dynamic_engine<WIDTH, REF_REG>;
+			_reflect = &engine::reflect;
+			_actual_poly = REF_REG ? _reflect(_cfg.poly) : _cfg.poly;
+			_actual_init = REF_REG ? _reflect(_cfg.init) : _cfg.init;
+			_table = dynamic_table_cache::instance().acquire(WIDTH, _actual_poly, REF_REG, &engine::generate);
+			_update = _table ? &engine::table_based_update : &engine::tableless_update;
+		}
+
+		template <int WIDTH>
+		void bind() noexcept {
+			if (_cfg.ref_reg)
+				bind<WIDTH, true>();
+			else
+				bind<WIDTH, false>();
+		}
+
+		void update(uint64& crc, const uint8* begin, const uint8* end) const noexcept {
+			if (_cfg.ref_in == _cfg.ref_reg) {
+				_update(_table, _actual_poly, crc, begin, end);
+				return;
+			}
+			uint8 block[REVERSED_INPUT_BLOCK_SIZE];
+			for (const uint8* p=begin; p<end; ) {
+				size_t n = reverse_input_block(p, end, block);
+				_update(_table, _actual_poly, crc, block, block+n);
+				p += n;
+			}
+		}
+
+		uint64 residue(uint64 crc) const noexcept {
+			return _cfg.ref_reg != _cfg.ref_out ? _reflect(crc) : crc;
+		}
+
+	public:
+		// Returns false if the width isn't 8, 16, 32 or 64.
+		static bool is_supported(const dynamic_cfg& cfg) noexcept {
+			return cfg.width == 8 || cfg.width == 16 || cfg.width == 32 || cfg.width == 64;
+		}
+
+		// The cfg has to be supported (see is_supported()): an unsupported
+		// width fails the PARAMETRIC_CRC_ASSERT check and the behavior is
+		// undefined if the assert is disabled.
+		explicit dynamic(const dynamic_cfg& cfg) noexcept : _cfg(cfg) {
+			PARAMETRIC_CRC_ASSERT(is_supported(cfg));
+			_mask = _cfg.width == 64 ? ~uint64(0) : (uint64(1) << _cfg.width) - 1;
+			_cfg.poly &= _mask;
+			_cfg.init &= _mask;
+			_cfg.xor_out &= _mask;
+			switch (_cfg.width) {
+			case 8:  bind<8>();  break;
+			case 16: bind<16>(); break;
+			case 32: bind<32>(); break;
+			default: bind<64>(); break;
+			}
+			_crc = _actual_init;
+		}
+
+		dynamic(const dynamic& other) noexcept : _cfg(other._cfg), _mask(other._mask),
+				_actual_init(other._actual_init), _actual_poly(other._actual_poly), _crc(other._crc),
+				_table(other._table), _update(other._update), _reflect(other._reflect) {
+			if (_table)
+				dynamic_table_cache::instance().add_ref(_table);
+		}
+
+		dynamic& operator=(const dynamic& other) noexcept {
+			if (this != &other) {
+				if (other._table)
+					dynamic_table_cache::instance().add_ref(other._table);
+				if (_table)
+					dynamic_table_cache::instance().release(_table);
+				_cfg = other._cfg;
+				_mask = other._mask;
+				_actual_init = other._actual_init;
+				_actual_poly = other._actual_poly;
+				_crc = other._crc;
+				_table = other._table;
+				_update = other._update;
+				_reflect = other._reflect;
+			}
+			return *this;
+		}
+
+		~dynamic() {
+			if (_table)
+				dynamic_table_cache::instance().release(_table);
+		}
+
+		const dynamic_cfg& cfg() const noexcept {
+			return _cfg;
+		}
+
+		// False if the table cache was full during construction and this
+		// instance falls back to the (slow) tableless calculation.
+		bool table_based() const noexcept {
+			return _table != nullptr;
+		}
+
+		void reset() noexcept {
+			_crc = _actual_init;
+		}
+
+		void update(const void* data, size_t size) noexcept {
+			update(_crc, (const uint8*)data, (const uint8*)data + size);
+		}
+
+		uint64 final() const noexcept {
+			return residue() ^ _cfg.xor_out;
+		}
+
+		uint64 interim() const noexcept {
+			return _crc;
+		}
+
+		uint64 residue() const noexcept {
+			return residue(_crc);
+		}
+
+		// Calculates the CRC of a buffer without changing the state of this instance.
+		uint64 calculate(const void* data, size_t size) const noexcept {
+			uint64 crc = _actual_init;
+			update(crc, (const uint8*)data, (const uint8*)data + size);
+			return residue(crc) ^ _cfg.xor_out;
+		}
+	};
+#endif // PARAMETRIC_CRC_DYNAMIC
+
+#ifdef PARAMETRIC_CRC_THREADS
+	// The maximum number of buffers of a crc::pipeline.
+	static constexpr size_t PIPELINE_MAX_BUFFERS = 8;
+
+	// A checksum stage that overlaps I/O with the CRC calculation. It owns
+	// num_buffers buffers (2 = double buffering, 3 = triple buffering) that
+	// are filled by the producer and processed in submission order by a
+	// worker thread while the producer fills the next one:
+	//
+	//    crc::pipeline<crc32::iscsi> stage(3, 1 << 20);
+	//    for (;;) {
+	//        uint8_t* buf = stage.acquire();  // blocks if all buffers are in flight
+	//        ssize_t n = read(fd, buf, stage.buffer_size());
+	//        if (n <= 0)
+	//            break;
+	//        stage.submit(n);
+	//    }
+	//    uint32_t crc_val = stage.final();  // waits for the submitted buffers
+	//
+	// The CRC template parameter can be any mode without a table parameter
+	// (e.g. crc32::iscsi::hw_accelerated). The acquire() and submit() calls
+	// have to alternate on a single producer thread.
+	template <typename CRC>
+	class pipeline {
+		using T = typename CRC::value_type;
+
+		std::unique_ptr<uint8[]> _buffers[PIPELINE_MAX_BUFFERS];
+		size_t _sizes[PIPELINE_MAX_BUFFERS];
+		size_t _num_buffers;
+		size_t _buffer_size;
+
+		// _submitted - _processed buffers are waiting for or under processing
+		size_t _submitted;
+		size_t _processed;
+		bool _closed;
+		CRC _crc;
+		std::mutex _mutex;
+		std::condition_variable _cond;
+		std::thread _worker;
+
+		void run() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			for (;;) {
+				_cond.wait(lock, [this] { return _closed || _submitted != _processed; });
+				if (_submitted == _processed)
+					return;
+				size_t i = _processed % _num_buffers;
+				lock.unlock();
+				_crc.update(_buffers[i].get(), _sizes[i]);
+				lock.lock();
+				_processed++;
+				_cond.notify_all();
+			}
+		}
+
+		void close() {
+			if (!_worker.joinable())
+				return;
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_closed = true;
+			}
+			_cond.notify_all();
+			_worker.join();
+		}
+
+	public:
+		pipeline(size_t num_buffers, size_t buffer_size) :
+				_num_buffers(num_buffers < 2 ? 2 : num_buffers > PIPELINE_MAX_BUFFERS ?
+					PIPELINE_MAX_BUFFERS : num_buffers),
+				_buffer_size(buffer_size), _submitted(0), _processed(0), _closed(false), _crc() {
+			for (size_t i=0; i<_num_buffers; i++)
+				_buffers[i].reset(new uint8[buffer_size]);
+			_worker = std::thread(&pipeline::run, this);
+		}
+		pipeline(const pipeline&) = delete;
+		pipeline& operator=(const pipeline&) = delete;
+
+		~pipeline() {
+			close();
+		}
+
+		size_t buffer_size() const noexcept {
+			return _buffer_size;
+		}
+
+		// Returns the next buffer to fill. Blocks while all buffers are
+		// waiting for or under processing.
+		uint8* acquire() {
+			std::unique_lock<std::mutex> lock(_mutex);
+			_cond.wait(lock, [this] { return _submitted - _processed < _num_buffers; });
+			return _buffers[_submitted % _num_buffers].get();
+		}
+
+		// Queues the first size bytes of the acquired buffer for processing.
+		void submit(size_t size) {
+			PARAMETRIC_CRC_ASSERT(size <= _buffer_size);
+			{
+				std::lock_guard<std::mutex> lock(_mutex);
+				_sizes[_submitted % _num_buffers] = size;
+				_submitted++;
+			}
+			_cond.notify_all();
+		}
+
+		// Closes the stream: waits for the submitted buffers and returns the
+		// final CRC. The other methods can't be called after this.
+		T final() {
+			close();
+			return _crc.final();
+		}
+
+		// Same as final() but returns an interim remainder (see impl::interim()).
+		T interim() {
+			close();
+			return _crc.interim();
+		}
 	};
+#endif
 
 } // namespace crc
 
@@ -1238,4 +4546,56 @@ namespace crc64 {
 	using crc64    = ecma_182;
 } // namespace crc64
 
+namespace crc {
+	// Calculates the CRC of a string with the table_based mode of CRC. It
+	// works in constant expressions (unlike CRC::calculate() with a char
+	// pointer that would need a reinterpret_cast) and its result is the same
+	// as the output of CRC::calculate(s, size) at runtime.
+	template <typename CRC>
+	constexpr typename CRC::value_type calculate_string(const char* s, size_t size) noexcept {
+		typename CRC::table_based crc;
+		for (size_t i=0; i<size; i++)
+			crc.update(s[i]);
+		return crc.final();
+	}
+
+	// The VALUE of this template is a template argument so it is evaluated
+	// at compile time even in contexts that aren't constant expressions
+	// (see PARAMETRIC_CRC_CONSTANT).
+	template <typename T, T V>
+	struct forced_constant {
+		static constexpr T VALUE = V;
+	};
+
+	// User-defined literals for the most common algorithms:
+	//
+	//    using namespace crc::literals;
+	//    switch (crc32::iso_hdlc::calculate(name, strlen(name))) {
+	//    case "start"_crc32: ...
+	//    case "stop"_crc32: ...
+	//    }
+	namespace literals {
+		constexpr uint8 operator""_crc8(const char* s, size_t size) noexcept {
+			return calculate_string<crc8::crc8>(s, size);
+		}
+		constexpr uint16 operator""_crc16(const char* s, size_t size) noexcept {
+			return calculate_string<crc16::crc16>(s, size);
+		}
+		constexpr uint32 operator""_crc32(const char* s, size_t size) noexcept {
+			return calculate_string<crc32::crc32>(s, size);
+		}
+		constexpr uint32 operator""_crc32c(const char* s, size_t size) noexcept {
+			return calculate_string<crc32::c>(s, size);
+		}
+		constexpr uint64 operator""_crc64(const char* s, size_t size) noexcept {
+			return calculate_string<crc64::crc64>(s, size);
+		}
+	} // namespace literals
+} // namespace crc
+
+// Evaluates a constant expression at compile time even where a runtime
+// evaluation would be allowed (e.g. in an argument of a function call):
+//    uint32_t id = PARAMETRIC_CRC_CONSTANT(crc::calculate_string<crc32::iscsi>("id", 2));
+#define PARAMETRIC_CRC_CONSTANT(expr) (::crc::forced_constant<decltype(expr), (expr)>::VALUE)
+
 #endif // PARAMETRIC_CRC_H
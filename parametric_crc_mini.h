@@ -18,6 +18,20 @@
 //    printf("CRC-16/XMODEM check=0x%04x\n", crc_obj.final());
 //
 // The tables of the used CRC algorithms are generated at compile time.
+//
+// Optional fast paths for large buffers (the interface doesn't change):
+//
+// Define PARAMETRIC_CRC_MINI_SLICED to process 8 input bytes per iteration
+// with a "slicing-by-8" table. The table of an algorithm is 8 times larger
+// (8KB with CRC-32) and takes longer to generate at compile time.
+//
+// Define PARAMETRIC_CRC_MINI_HW_CRC32C to calculate CRC-32C (crc32::iscsi)
+// with the CRC32 instructions of SSE4.2 or ARMv8. They are used only if the
+// compiler targets them (e.g. -msse4.2, -march=armv8-a+crc) because the mini
+// header doesn't detect the CPU at runtime. Compile time evaluation uses the
+// tables so __builtin_is_constant_evaluated() is required (GCC 9+, Clang 9+,
+// MSVC 19.25+). The full header (parametric_crc.h) has CLMUL/PMULL folding
+// for the other algorithms too.
 
 #ifndef PARAMETRIC_CRC_MINI_H
 #define PARAMETRIC_CRC_MINI_H
@@ -26,6 +40,26 @@
 #include <stdint.h>  // not needed if you define uint16_t, uint32_t and uint64_t
 #endif
 
+#ifdef PARAMETRIC_CRC_MINI_HW_CRC32C
+#  if defined(__has_builtin)
+#    if __has_builtin(__builtin_is_constant_evaluated)
+#      define PARAMETRIC_CRC_MINI_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#    endif
+#  elif defined(_MSC_VER) && _MSC_VER >= 1925
+#    define PARAMETRIC_CRC_MINI_IS_CONSTANT_EVALUATED() __builtin_is_constant_evaluated()
+#  endif
+#  ifndef PARAMETRIC_CRC_MINI_IS_CONSTANT_EVALUATED
+#    error "PARAMETRIC_CRC_MINI_HW_CRC32C requires __builtin_is_constant_evaluated()"
+#  endif
+#  if defined(__SSE4_2__) || (defined(_MSC_VER) && defined(__AVX__))
+#    define PARAMETRIC_CRC_MINI_HW_X86
+#    include <nmmintrin.h>
+#  elif (defined(__aarch64__) || defined(_M_ARM64)) && defined(__ARM_FEATURE_CRC32)
+#    define PARAMETRIC_CRC_MINI_HW_ARM64
+#    include <arm_acle.h>
+#  endif
+#endif
+
 namespace crc {
 
 	using uint8_t = unsigned char;
@@ -76,6 +110,61 @@ namespace crc {
 		}
 	};
 
+#ifdef PARAMETRIC_CRC_MINI_SLICED
+	// rows[0] is the lookup_table and rows[k][i] is the CRC register after
+	// feeding k zero bytes into rows[0][i]. The loops of base<> look up the 8
+	// bytes of a block in rows[7]..rows[0] so the first byte of the block is
+	// followed by 7 other bytes (zeros from its point of view).
+	template <typename T, T REF_POLY, bool REF>
+	struct sliced_lookup_table {
+		T rows[8][0x100];
+		constexpr sliced_lookup_table() noexcept : rows() {
+			constexpr auto& tbl = static_table<lookup_table<T, REF_POLY, REF>>::instance.entries;
+			for (uint16_t i=0; i<0x100; i++)
+				rows[0][i] = tbl[i];
+			for (int k=1; k<8; k++) {
+				for (uint16_t i=0; i<0x100; i++) {
+					T v = rows[k-1][i];
+					rows[k][i] = REF ? (tbl[uint8_t(v)] ^ (v >> 4 >> 4)) : (tbl[v >> (sizeof(T)*8-8)] ^ (v << 4 << 4));
+				}
+			}
+		}
+	};
+#endif
+
+#if defined(PARAMETRIC_CRC_MINI_HW_X86) || defined(PARAMETRIC_CRC_MINI_HW_ARM64)
+	// little endian loads, the compilers turn them into single load instructions
+	inline uint32_t load_le32(const uint8_t* p) noexcept {
+		return uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24);
+	}
+	inline uint64_t load_le64(const uint8_t* p) noexcept {
+		return uint64_t(load_le32(p)) | (uint64_t(load_le32(p + 4)) << 32);
+	}
+
+	// crc is the reflected CRC-32C register
+	inline uint32_t hw_crc32c_update(uint32_t crc, const uint8_t* p, const uint8_t* end) noexcept {
+#  if defined(PARAMETRIC_CRC_MINI_HW_ARM64)
+		for (; end-p >= 8; p+=8)
+			crc = __crc32cd(crc, load_le64(p));
+		for (; p<end; p++)
+			crc = __crc32cb(crc, *p);
+#  elif defined(__x86_64__) || defined(_M_X64)
+		uint64_t crc64 = crc;
+		for (; end-p >= 8; p+=8)
+			crc64 = _mm_crc32_u64(crc64, load_le64(p));
+		crc = uint32_t(crc64);
+		for (; p<end; p++)
+			crc = _mm_crc32_u8(crc, *p);
+#  else
+		for (; end-p >= 4; p+=4)
+			crc = _mm_crc32_u32(crc, load_le32(p));
+		for (; p<end; p++)
+			crc = _mm_crc32_u8(crc, *p);
+#  endif
+		return crc;
+	}
+#endif
+
 	template <typename T, T POLY, T INIT, T XOR_OUT, bool REF_IN, bool REF_OUT=REF_IN>
 	struct base;
 
@@ -83,7 +172,19 @@ namespace crc {
 	struct base<T, POLY, INIT, XOR_OUT, false, REF_OUT> { // REF_IN=false: unreflected CRC register
 		static constexpr T calculate(const uint8_t* begin, const uint8_t* end, bool interim=false, T crc=INIT) noexcept {
 			constexpr auto& tbl = static_table<lookup_table<T, reverse_bits(POLY), false>>::instance.entries;
-			for (auto p=begin; p<end; p++) // (crc << 8) would emit compiler warnings with T=uint8_t
+			auto p = begin;
+#ifdef PARAMETRIC_CRC_MINI_SLICED
+			constexpr auto& rows = static_table<sliced_lookup_table<T, reverse_bits(POLY), false>>::instance.rows;
+			for (; end-p >= 8; p+=8) {
+				// the top byte of the register is xored with the first (most significant) byte of the block
+				uint64_t x = (uint64_t(p[0]) << 56) | (uint64_t(p[1]) << 48) | (uint64_t(p[2]) << 40) | (uint64_t(p[3]) << 32)
+					| (uint64_t(p[4]) << 24) | (uint64_t(p[5]) << 16) | (uint64_t(p[6]) << 8) | uint64_t(p[7]);
+				x ^= uint64_t(crc) << (64 - sizeof(T)*8);
+				crc = rows[7][x >> 56] ^ rows[6][uint8_t(x >> 48)] ^ rows[5][uint8_t(x >> 40)] ^ rows[4][uint8_t(x >> 32)]
+					^ rows[3][uint8_t(x >> 24)] ^ rows[2][uint8_t(x >> 16)] ^ rows[1][uint8_t(x >> 8)] ^ rows[0][uint8_t(x)];
+			}
+#endif
+			for (; p<end; p++) // (crc << 8) would emit compiler warnings with T=uint8_t
 				crc = tbl[(crc >> (sizeof(T)*8-8)) ^ *p] ^ (crc << 4 << 4);
 			return interim ? crc : ((REF_OUT ? reverse_bits(crc) : crc) ^ XOR_OUT);
 		}
@@ -93,7 +194,25 @@ namespace crc {
 	struct base<T, POLY, INIT, XOR_OUT, true, REF_OUT> { // REF_IN=true: reflected CRC register
 		static constexpr T calculate(const uint8_t* begin, const uint8_t* end, bool interim=false, T crc=reverse_bits(INIT)) noexcept {
 			constexpr auto& tbl = static_table<lookup_table<T, reverse_bits(POLY), true>>::instance.entries;
-			for (auto p=begin; p<end; p++) // (crc >> 8) would emit compiler warnings with T=uint8_t
+			auto p = begin;
+#if defined(PARAMETRIC_CRC_MINI_HW_X86) || defined(PARAMETRIC_CRC_MINI_HW_ARM64)
+			if (sizeof(T) == 4 && POLY == T(0x1edc6f41) && !PARAMETRIC_CRC_MINI_IS_CONSTANT_EVALUATED()) {
+				crc = T(hw_crc32c_update(uint32_t(crc), p, end));
+				p = end;
+			}
+#endif
+#ifdef PARAMETRIC_CRC_MINI_SLICED
+			constexpr auto& rows = static_table<sliced_lookup_table<T, reverse_bits(POLY), true>>::instance.rows;
+			for (; end-p >= 8; p+=8) {
+				// the low byte of the register is xored with the first (least significant) byte of the block
+				uint64_t x = uint64_t(p[0]) | (uint64_t(p[1]) << 8) | (uint64_t(p[2]) << 16) | (uint64_t(p[3]) << 24)
+					| (uint64_t(p[4]) << 32) | (uint64_t(p[5]) << 40) | (uint64_t(p[6]) << 48) | (uint64_t(p[7]) << 56);
+				x ^= crc;
+				crc = rows[7][uint8_t(x)] ^ rows[6][uint8_t(x >> 8)] ^ rows[5][uint8_t(x >> 16)] ^ rows[4][uint8_t(x >> 24)]
+					^ rows[3][uint8_t(x >> 32)] ^ rows[2][uint8_t(x >> 40)] ^ rows[1][uint8_t(x >> 48)] ^ rows[0][x >> 56];
+			}
+#endif
+			for (; p<end; p++) // (crc >> 8) would emit compiler warnings with T=uint8_t
 				crc = tbl[uint8_t(crc) ^ *p] ^ (crc >> 4 >> 4);
 			return interim ? crc : ((REF_OUT ? crc : reverse_bits(crc)) ^ XOR_OUT);
 		}
@@ -0,0 +1,228 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// Generates a header with precomputed lookup tables for the static_table<>
+// instances of the library (see PARAMETRIC_CRC_EXTERN_TABLES). The tables of
+// the header are defined in a single translation unit so the rest of the
+// program doesn't evaluate the constexpr table generators at compile time.
+//
+// Build and run:
+//    g++ -std=c++14 -O2 table_gen.cpp -o table_gen
+//    ./table_gen table:32:0x1edc6f41:1 sliced16:64:0x42f0e1eba9ea3693:1 > crc_tables.h
+//
+// Usage: table_gen TABLE...
+//    TABLE: KIND:WIDTH:POLY:REF_REG where
+//       KIND:    table, small_table, pre_reflected_table, sliced8 or sliced16
+//                (the table_type of table_based, small_table_based,
+//                pre_reflected_table_based and sliced_table_based<N>)
+//       WIDTH:   8, 16, 32 or 64
+//       POLY:    the unreflected polynomial
+//       REF_REG: 1 for a reflected CRC register, 0 otherwise
+//
+// Using the generated header:
+//    - Every translation unit that includes parametric_crc.h has to be
+//      compiled with -DPARAMETRIC_CRC_EXTERN_TABLES='"crc_tables.h"'.
+//    - Exactly one of them has to define PARAMETRIC_CRC_DEFINE_TABLES before
+//      including parametric_crc.h. That translation unit holds the tables.
+// The modes that use these tables can't be evaluated at compile time.
+// A translation unit compiled without PARAMETRIC_CRC_EXTERN_TABLES uses its
+// own constexpr copy of the tables: that is an ODR violation. GNU ld reports
+// it as a multiple definition of static_table<>::instance but only if that
+// translation unit references the table at runtime.
+// test_tables.h (the tables of test.cpp) is an example of the output.
+
+#include "parametric_crc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>    // uint64_t
+#include <inttypes.h>  // PRIx64 macro
+#include <string.h>
+
+namespace {
+
+enum class kind { table, small_table, pre_reflected_table, sliced8, sliced16 };
+
+struct table_spec {
+	kind k;
+	int width;
+	uint64_t poly;
+	bool ref_reg;
+};
+
+bool parse_kind(const char* s, size_t len, kind& k) {
+	static const struct { const char* name; kind k; } KINDS[] = {
+		{ "table", kind::table },
+		{ "small_table", kind::small_table },
+		{ "pre_reflected_table", kind::pre_reflected_table },
+		{ "sliced8", kind::sliced8 },
+		{ "sliced16", kind::sliced16 },
+	};
+	for (const auto& e : KINDS) {
+		if (strlen(e.name) == len && !strncmp(e.name, s, len)) {
+			k = e.k;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool parse_spec(const char* s, table_spec& spec) {
+	const char* colon = strchr(s, ':');
+	if (!colon || !parse_kind(s, size_t(colon - s), spec.k))
+		return false;
+	char* end = nullptr;
+	spec.width = int(strtol(colon + 1, &end, 10));
+	if (*end != ':' || (spec.width != 8 && spec.width != 16 && spec.width != 32 && spec.width != 64))
+		return false;
+	spec.poly = strtoull(end + 1, &end, 0);
+	if (*end != ':' || (end[1] != '0' && end[1] != '1') || end[2])
+		return false;
+	spec.ref_reg = end[1] == '1';
+	if (spec.width < 64)
+		spec.poly &= (uint64_t(1) << spec.width) - 1;
+	return true;
+}
+
+// The name of the C++ type of the table, e.g. crc::table<crc::tbl_cfg<32, 0x1edc6f41, true>>.
+void format_type(const table_spec& spec, char* buf, size_t size) {
+	char cfg[0x80];
+	snprintf(cfg, sizeof(cfg), "crc::tbl_cfg<%d, 0x%0*" PRIx64 ", %s>",
+		spec.width, spec.width / 4, spec.poly, spec.ref_reg ? "true" : "false");
+	switch (spec.k) {
+	case kind::table:               snprintf(buf, size, "crc::table<%s>", cfg); break;
+	case kind::small_table:         snprintf(buf, size, "crc::small_table<%s>", cfg); break;
+	case kind::pre_reflected_table: snprintf(buf, size, "crc::pre_reflected_table<%s>", cfg); break;
+	case kind::sliced8:             snprintf(buf, size, "crc::sliced_table<%s, 8>", cfg); break;
+	case kind::sliced16:            snprintf(buf, size, "crc::sliced_table<%s, 16>", cfg); break;
+	}
+}
+
+template <typename T>
+void print_entries(const T* entries, int count, const char* indent) {
+	const int per_line = sizeof(T) == 8 ? 4 : 8;
+	for (int i=0; i<count; i++) {
+		printf("%s0x%0*" PRIx64 ",", i % per_line ? " " : indent, int(sizeof(T) * 2), uint64_t(entries[i]));
+		if (i % per_line == per_line - 1)
+			printf("\n");
+	}
+}
+
+// Prints the constexpr arrays of table number index and returns the
+// constructor arguments of the table in args.
+template <int WIDTH, bool REF_REG>
+void print_data(const table_spec& spec, int index, char* args, size_t args_size) {
+	using T = crc::uint<WIDTH>;
+	using core = crc::core<WIDTH, REF_REG>;
+	const T poly = crc::conditional_reflect<T, REF_REG>::fn(T(spec.poly));
+	const char* type_name = WIDTH == 8 ? "crc::uint8" : WIDTH == 16 ? "crc::uint16" :
+		WIDTH == 32 ? "crc::uint32" : "crc::uint64";
+
+	if (spec.k == kind::small_table) {
+		T first_row[16] = {}, first_column[16] = {};
+		core::generate_small_table(poly, first_row, first_column);
+		printf("\tconstexpr %s table_%d_first_row[16] = {\n", type_name, index);
+		print_entries(first_row, 16, "\t\t");
+		printf("\t};\n\tconstexpr %s table_%d_first_column[16] = {\n", type_name, index);
+		print_entries(first_column, 16, "\t\t");
+		printf("\t};\n");
+		snprintf(args, args_size, "crc_generated_tables::table_%d_first_row, crc_generated_tables::table_%d_first_column",
+			index, index);
+		return;
+	}
+
+	if (spec.k == kind::sliced8 || spec.k == kind::sliced16) {
+		static T rows[16][256];
+		int num_rows = spec.k == kind::sliced8 ? 8 : 16;
+		if (num_rows == 8)
+			core::template generate_sliced_table<8>(poly, rows);
+		else
+			core::template generate_sliced_table<16>(poly, rows);
+		printf("\tconstexpr %s table_%d[%d][256] = {\n", type_name, index, num_rows);
+		for (int r=0; r<num_rows; r++) {
+			printf("\t\t{\n");
+			print_entries(rows[r], 256, "\t\t\t");
+			printf("\t\t},\n");
+		}
+		printf("\t};\n");
+		snprintf(args, args_size, "crc_generated_tables::table_%d", index);
+		return;
+	}
+
+	T entries[256] = {};
+	core::generate_table(poly, entries);
+	if (spec.k == kind::pre_reflected_table) {
+		T normal[256];
+		memcpy(normal, entries, sizeof(normal));
+		for (int i=0; i<256; i++)
+			entries[i] = crc::reverse_bits_of_bytes(normal[crc::reverse_bits(crc::uint8(i))]);
+	}
+	printf("\tconstexpr %s table_%d[256] = {\n", type_name, index);
+	print_entries(entries, 256, "\t\t");
+	printf("\t};\n");
+	snprintf(args, args_size, "crc_generated_tables::table_%d", index);
+}
+
+template <int WIDTH>
+void print_data(const table_spec& spec, int index, char* args, size_t args_size) {
+	if (spec.ref_reg)
+		print_data<WIDTH, true>(spec, index, args, args_size);
+	else
+		print_data<WIDTH, false>(spec, index, args, args_size);
+}
+
+void print_data(const table_spec& spec, int index, char* args, size_t args_size) {
+	switch (spec.width) {
+	case 8:  print_data<8>(spec, index, args, args_size); break;
+	case 16: print_data<16>(spec, index, args, args_size); break;
+	case 32: print_data<32>(spec, index, args, args_size); break;
+	default: print_data<64>(spec, index, args, args_size); break;
+	}
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+	if (argc < 2) {
+		fprintf(stderr, "Usage: table_gen KIND:WIDTH:POLY:REF_REG...\n");
+		return 1;
+	}
+	table_spec specs[64];
+	int num_specs = argc - 1;
+	if (num_specs > int(sizeof(specs) / sizeof(specs[0]))) {
+		fprintf(stderr, "Too many tables.\n");
+		return 1;
+	}
+	for (int i=0; i<num_specs; i++) {
+		if (!parse_spec(argv[i + 1], specs[i])) {
+			fprintf(stderr, "Invalid table: %s\n", argv[i + 1]);
+			return 1;
+		}
+	}
+
+	printf("// Generated by table_gen:");
+	for (int i=1; i<argc; i++)
+		printf(" %s", argv[i]);
+	printf("\n//\n");
+	printf("// Compile every translation unit with -DPARAMETRIC_CRC_EXTERN_TABLES='\"<this file>\"'\n");
+	printf("// and define PARAMETRIC_CRC_DEFINE_TABLES in one of them (see table_gen.cpp).\n");
+	printf("// Forgetting the former in a translation unit is an ODR violation.\n\n");
+
+	char type[0x100];
+	for (int i=0; i<num_specs; i++) {
+		format_type(specs[i], type, sizeof(type));
+		printf("PARAMETRIC_CRC_EXTERN_STATIC_TABLE(%s)\n", type);
+	}
+
+	printf("\n#ifdef PARAMETRIC_CRC_DEFINE_TABLES\n\n");
+	char args[0x100];
+	for (int i=0; i<num_specs; i++) {
+		format_type(specs[i], type, sizeof(type));
+		printf("namespace crc_generated_tables {\n");
+		print_data(specs[i], i, args, sizeof(args));
+		printf("} // namespace crc_generated_tables\n");
+		printf("const %s crc::static_table<%s>::instance(%s);\n\n", type, type, args);
+	}
+	printf("#endif // PARAMETRIC_CRC_DEFINE_TABLES\n");
+	return 0;
+}
@@ -11,6 +11,18 @@
 //#define PARAMETRIC_CRC_REVERSE_BITS_NIBBLE_LOOKUP_TABLE
 //#define PARAMETRIC_CRC_NO_REVERSE_BITS_LOOKUP_TABLE
 //#define PARAMETRIC_CRC_SIMPLE_TABLE_GENERATOR
+//#define PARAMETRIC_CRC_NO_HW_ACCELERATION
+//#define PARAMETRIC_CRC_TABLE_ALIGNMENT 64
+#define PARAMETRIC_CRC_DYNAMIC
+#define PARAMETRIC_CRC_TABLE_ALLOCATION
+
+// The tables of zoo_a2eb (see test_extern_tables()) generated with:
+//    ./table_gen table:16:0xa2eb:1 small_table:16:0xa2eb:1 sliced8:16:0xa2eb:1 > test_tables.h
+#define PARAMETRIC_CRC_EXTERN_TABLES "test_tables.h"
+#define PARAMETRIC_CRC_DEFINE_TABLES
+
+// test_threads.cpp builds this test with PARAMETRIC_CRC_THREADS and
+// test_stats.cpp with PARAMETRIC_CRC_STATS and PARAMETRIC_CRC_STATS_TIMING.
 #include "parametric_crc.h"
 
 #include <stdio.h>
@@ -28,9 +40,49 @@
 #  define STATIC_ASSERT(cond, msg)
 #endif
 
-// This template function will be instantiated for each subtype (tableless,
-// table_based, ext_table_based, etc...) of every tested CRC algorithm twice:
-// with and without a reflected CRC shift register.
+// An independent bit-serial reference for update_bits(): an unreflected
+// register fed one bit at a time in transmission order.
+template <typename CRC>
+uint64_t bit_serial_crc(const uint8_t* data, size_t bit_count) {
+	const uint64_t mask = ~uint64_t(0) >> (64 - CRC::WIDTH);
+	uint64_t reg = uint64_t(CRC::INIT);
+	for (size_t i=0; i<bit_count; i++) {
+		unsigned bit = CRC::REF_IN ? (data[i/8] >> (i%8)) & 1 : (data[i/8] >> (7 - i%8)) & 1;
+		bool top = ((reg >> (CRC::WIDTH - 1)) & 1) != bit;
+		reg = (reg << 1) & mask;
+		if (top)
+			reg ^= uint64_t(CRC::POLY);
+	}
+	if (CRC::REF_OUT)
+		reg = crc::reverse_bits(uint64_t(reg)) >> (64 - CRC::WIDTH);
+	return reg ^ uint64_t(CRC::XOR_OUT);
+}
+
+// Appends crc_val to the first size bytes of the codeword in the byte order
+// that forms a valid codeword and returns the size of the codeword.
+template <typename CRC>
+size_t append_check_value(char* codeword, size_t size, typename CRC::value_type crc_val) {
+	if (CRC::REF_IN != CRC::REF_OUT)
+		crc_val = crc::reverse_bits(crc_val);
+
+	if (CRC::REF_IN) {
+		// LSB: append crc_val in little endian format
+		for (size_t i=0; i<sizeof(typename CRC::value_type); i++)
+			codeword[size++] = char(crc_val >> (i*8));
+	}
+	else {
+		// MSB: append crc_val in big endian format
+		for (int i=int(sizeof(typename CRC::value_type))-1; i>=0; i--)
+			codeword[size++] = char(crc_val >> (i*8));
+	}
+	return size;
+}
+
+// This template function will be instantiated for the baseline subtypes
+// (tableless, table_based, ext_table_based, etc...) of every tested CRC
+// algorithm and for every subtype of a representative subset of the
+// algorithms (see test_all_modes()) twice: with and without a reflected CRC
+// shift register.
 template <typename CRC>
 int run_one(const char* name, uint64_t check_value, uint64_t residue_const) {
 	static constexpr int NAME_W = 55;
@@ -65,22 +117,10 @@ int run_one(const char* name, uint64_t check_value, uint64_t residue_const) {
 
 	char codeword[9 + sizeof(typename CRC::value_type)];
 	strcpy(codeword, "123456789");
-	size_t size = 9;
-
+	size_t size = append_check_value<CRC>(codeword, 9, crc_val);
 	if (CRC::REF_IN != CRC::REF_OUT)
 		crc_val = crc::reverse_bits(crc_val);
 
-	if (CRC::REF_IN) {
-		// LSB: append crc_val in little endian format
-		for (size_t i=0; i<sizeof(typename CRC::value_type); i++)
-			codeword[size++] = char(crc_val >> (i*8));
-	}
-	else {
-		// MSB: append crc_val in big endian format
-		for (int i=int(sizeof(typename CRC::value_type))-1; i>=0; i--)
-			codeword[size++] = char(crc_val >> (i*8));
-	}
-
 	CRC crc_obj_2;
 	crc_obj_2.update(codeword, size);
 	auto rc = crc_obj_2.residue();
@@ -95,6 +135,185 @@ int run_one(const char* name, uint64_t check_value, uint64_t residue_const) {
 	return 0;
 }
 
+// The checks of the features added on top of the baseline modes (verify(),
+// segments, copy_and_update(), update_bits(), patch(), combine(), save_state())
+// for the representative subset of the algorithms. Returns the number of errors.
+template <typename CRC>
+int run_one_features(const char* name) {
+	static constexpr int NAME_W = 55;
+	// two hex nibbles per byte
+	static constexpr int CRC_W = sizeof(typename CRC::value_type) * 2;
+
+	char codeword[9 + sizeof(typename CRC::value_type)];
+	strcpy(codeword, "123456789");
+	CRC check_obj;
+	check_obj.update(codeword, 9);
+	size_t size = append_check_value<CRC>(codeword, 9, check_obj.final());
+
+	CRC verifier;
+	bool verified = verifier.verify(codeword, size);
+	codeword[size - 1] ^= 0x80;
+	bool verified_corrupt = verifier.verify(codeword, size);
+	codeword[size - 1] ^= 0x80;
+	if (!verified || verified_corrupt) {
+		printf("%-*s verify()=%d verify(corrupt)=%d fail\n",
+			NAME_W, name, int(verified), int(verified_corrupt));
+		return 1;
+	}
+
+	// A longer input processed by multiple update() calls of various sizes
+	// (to exercise the block based code paths of some modes) and compared
+	// to the output of the tableless mode.
+
+	using reference_t = typename crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT,
+		CRC::XOR_OUT, CRC::REF_IN, CRC::REF_OUT>::tableless;
+
+	uint8_t long_data[1000];
+	uint32_t seed = 12345;
+	for (size_t i=0; i<sizeof(long_data); i++) {
+		seed = seed * 1103515245 + 12345;
+		long_data[i] = uint8_t(seed >> 16);
+	}
+
+	CRC crc_obj_3;
+	size_t pos = 0;
+	for (size_t len=0; pos+len <= sizeof(long_data); pos+=len, len++)
+		crc_obj_3.update(long_data + pos, len);
+	auto long_crc = crc_obj_3.final();
+	auto long_expected = reference_t::calculate(long_data, pos);
+	if (long_crc != long_expected) {
+		printf("%-*s long_crc=%0*" PRIx64 " expected(long_crc)=%0*" PRIx64 " fail\n",
+			NAME_W, name, CRC_W, (uint64_t)long_crc, CRC_W, (uint64_t)long_expected);
+		return 1;
+	}
+
+	// The long input processed by a single update() call
+
+	CRC crc_obj_4;
+	crc_obj_4.update(long_data, sizeof(long_data));
+	auto long_crc_2 = crc_obj_4.final();
+	auto long_expected_2 = reference_t::calculate(long_data, sizeof(long_data));
+	if (long_crc_2 != long_expected_2) {
+		printf("%-*s long_crc_2=%0*" PRIx64 " expected(long_crc_2)=%0*" PRIx64 " fail\n",
+			NAME_W, name, CRC_W, (uint64_t)long_crc_2, CRC_W, (uint64_t)long_expected_2);
+		return 1;
+	}
+
+	// The long input split into segments of various sizes and processed by
+	// a single update() call
+
+	// sizes: 0, 1, 3, 7 (x20), 15, 31, 63, 127, 255, 365
+	crc::segment segs[32];
+	size_t num_segs = 0;
+	for (size_t seg_pos=0, len=0; seg_pos < sizeof(long_data); len=len*2+1) {
+		for (int i=0; i < (len==7 ? 20 : 1); i++) {
+			size_t n = len < sizeof(long_data) - seg_pos ? len : sizeof(long_data) - seg_pos;
+			segs[num_segs].data = long_data + seg_pos;
+			segs[num_segs].size = n;
+			num_segs++;
+			seg_pos += n;
+		}
+	}
+	CRC crc_obj_5;
+	crc_obj_5.update(segs, num_segs);
+	auto segs_crc = crc_obj_5.final();
+	if (segs_crc != long_expected_2) {
+		printf("%-*s segs_crc=%0*" PRIx64 " expected(long_crc_2)=%0*" PRIx64 " fail\n",
+			NAME_W, name, CRC_W, (uint64_t)segs_crc, CRC_W, (uint64_t)long_expected_2);
+		return 1;
+	}
+
+	// Copying the long input while updating the CRC
+
+	for (int nt=0; nt<2; nt++) {
+		uint8_t copy[sizeof(long_data)] = {};
+		CRC copy_obj;
+		if (nt)
+			copy_obj.copy_and_update_nt(copy, long_data, sizeof(long_data));
+		else
+			copy_obj.copy_and_update(copy, long_data, sizeof(long_data));
+		auto copy_crc = copy_obj.final();
+		if (copy_crc != long_expected_2 || memcmp(copy, long_data, sizeof(long_data))) {
+			printf("%-*s copy_crc=%0*" PRIx64 " expected(long_crc_2)=%0*" PRIx64 " nt=%d fail\n",
+				NAME_W, name, CRC_W, (uint64_t)copy_crc, CRC_W, (uint64_t)long_expected_2, nt);
+			return 1;
+		}
+	}
+
+	// Bit granular input: whole bytes followed by a partial byte
+
+	static const size_t BIT_COUNTS[] = { 0, 1, 7, 8, 13, 8*500 + 3, 8*999 + 7 };
+	for (size_t bit_count : BIT_COUNTS) {
+		CRC bits_obj;
+		bits_obj.update_bits(long_data, bit_count);
+		auto bits_crc = bits_obj.final();
+		auto bits_expected = bit_serial_crc<CRC>(long_data, bit_count);
+		if (bits_crc != bits_expected) {
+			printf("%-*s bits_crc=%0*" PRIx64 " expected(bits_crc)=%0*" PRIx64 " bit_count=%d fail\n",
+				NAME_W, name, CRC_W, (uint64_t)bits_crc, CRC_W, bits_expected, int(bit_count));
+			return 1;
+		}
+	}
+
+	// Patching the CRC of the long input after overwriting some of its bytes
+
+	static const size_t PATCH_RANGES[][2] = { {0, 0}, {0, 1}, {10, 300}, {999, 1}, {0, 1000}, {500, 500} };
+	for (const auto& range : PATCH_RANGES) {
+		uint8_t modified[sizeof(long_data)];
+		memcpy(modified, long_data, sizeof(long_data));
+		for (size_t i=range[0]; i<range[0]+range[1]; i++)
+			modified[i] = uint8_t(modified[i] * 3 + i);
+		CRC patcher;
+		auto patched_crc = patcher.patch(long_expected_2, sizeof(long_data), range[0],
+			long_data + range[0], modified + range[0], range[1]);
+		auto patched_expected = reference_t::calculate(modified, sizeof(modified));
+		if (patched_crc != patched_expected) {
+			printf("%-*s patched_crc=%0*" PRIx64 " expected(patched_crc)=%0*" PRIx64 " offset=%d n=%d fail\n",
+				NAME_W, name, CRC_W, (uint64_t)patched_crc, CRC_W, (uint64_t)patched_expected,
+				int(range[0]), int(range[1]));
+			return 1;
+		}
+	}
+
+	// The long input split into two chunks at various positions and combined
+
+	for (size_t split=0; split<=pos; split+=pos/7) {
+		auto combined_crc = CRC::combine(reference_t::calculate(long_data, split),
+			reference_t::calculate(long_data + split, pos - split), pos - split);
+		if (combined_crc != long_expected) {
+			printf("%-*s combined_crc=%0*" PRIx64 " expected(long_crc)=%0*" PRIx64 " split=%d fail\n",
+				NAME_W, name, CRC_W, (uint64_t)combined_crc, CRC_W, (uint64_t)long_expected, int(split));
+			return 1;
+		}
+	}
+
+	// A checkpoint of the long input restored by another object of this mode
+	// and by the reference mode (possibly with a different REF_REG)
+
+	uint8_t state[crc::SAVED_STATE_SIZE];
+	CRC saver;
+	saver.update(long_data, 333);
+	saver.save_state(state, 333);
+	CRC resumed;
+	reference_t resumed_ref;
+	uint64_t offset = 0, offset_ref = 0;
+	bool restored = resumed.restore_state(state, offset) && resumed_ref.restore_state(state, offset_ref);
+	if (restored) {
+		resumed.update(long_data + offset, sizeof(long_data) - size_t(offset));
+		resumed_ref.update(long_data + offset_ref, sizeof(long_data) - size_t(offset_ref));
+	}
+	state[40] ^= 1;
+	CRC rejecter;
+	bool restored_corrupt = rejecter.restore_state(state, offset);
+	if (!restored || offset != 333 || offset_ref != 333 || restored_corrupt
+			|| resumed.final() != long_expected_2 || resumed_ref.final() != long_expected_2) {
+		printf("%-*s restored=%d restored_corrupt=%d restore_state() fail\n",
+			NAME_W, name, int(restored), int(restored_corrupt));
+		return 1;
+	}
+	return 0;
+}
+
 // This template pretends to be a CRC implementation that doesn't require
 // a table parameter in its update() method but internally its a CRC
 // implementation with an external table.
@@ -114,9 +333,37 @@ struct etb {
 	typename ext_table_based::table_type table;
 	ext_table_based crc;
 
+	static constexpr T combine(T crc_a, T crc_b, size_t size_b) {
+		return ext_table_based::combine(crc_a, crc_b, size_b);
+	}
+
 	void update(const void* data, size_t size) {
 		crc.update(data, size, table);
 	}
+	void update(const crc::segment* segs, size_t count) {
+		crc.update(segs, count, table);
+	}
+	void copy_and_update(void* dst, const void* src, size_t size) {
+		crc.copy_and_update(dst, src, size, table);
+	}
+	void copy_and_update_nt(void* dst, const void* src, size_t size) {
+		crc.copy_and_update_nt(dst, src, size, table);
+	}
+	void update_bits(const void* data, size_t bit_count) {
+		crc.update_bits(data, bit_count, table);
+	}
+	bool verify(const void* codeword, size_t size) const {
+		return ext_table_based::verify(codeword, size, table);
+	}
+	void save_state(void* out, uint64_t offset) const {
+		crc.save_state(out, offset);
+	}
+	bool restore_state(const void* in, uint64_t& offset) {
+		return crc.restore_state(in, offset);
+	}
+	T patch(T crc_val, size_t size, size_t offset, const void* old_data, const void* new_data, size_t n) const {
+		return ext_table_based::patch(crc_val, size, offset, old_data, new_data, n, table);
+	}
 	T final() const {
 		return crc.final();
 	}
@@ -125,6 +372,39 @@ struct etb {
 	}
 };
 
+// Inputs around PARAMETRIC_CRC_VPCLMUL_MIN_SIZE exercise the 512-bit folding
+// engine of the hw_accelerated mode (on CPUs with VPCLMULQDQ) and the 128-bit
+// engine below the threshold. Returns the number of errors.
+template <typename CRC>
+int test_large_input(const char* name) {
+	using reference_t = typename crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT,
+		CRC::XOR_OUT, CRC::REF_IN, CRC::REF_OUT>::table_based;
+	static uint8_t data[3 * PARAMETRIC_CRC_VPCLMUL_MIN_SIZE + 100];
+	uint32_t seed = 54321;
+	for (size_t i=0; i<sizeof(data); i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = uint8_t(seed >> 16);
+	}
+	const size_t sizes[] = {
+		PARAMETRIC_CRC_VPCLMUL_MIN_SIZE - 1, PARAMETRIC_CRC_VPCLMUL_MIN_SIZE,
+		PARAMETRIC_CRC_VPCLMUL_MIN_SIZE + 255, 2 * PARAMETRIC_CRC_VPCLMUL_MIN_SIZE + 81,
+		sizeof(data) - 1,
+	};
+	int errors = 0;
+	for (size_t size : sizes) {
+		// unaligned input
+		auto v = CRC::calculate(data + 1, size);
+		auto expected = reference_t::calculate(data + 1, size);
+		if (v != expected) {
+			printf("%s size=%d output=%" PRIx64 " expected=%" PRIx64 " fail\n",
+				name, int(size), (uint64_t)v, (uint64_t)expected);
+			errors++;
+		}
+	}
+	return errors;
+}
+
+// The baseline modes of every algorithm of the catalogue.
 // Returns the number of errors.
 template <typename CRC, bool REFLECTED_CRC_REGISTER>
 int test_modes(const char* name, uint64_t check_value, uint64_t residue_const) {
@@ -152,6 +432,390 @@ int test_modes(const char* name, uint64_t check_value, uint64_t residue_const) {
 	return errors;
 }
 
+template <typename CRC>
+int run_one_all(const char* name, uint64_t check_value, uint64_t residue_const) {
+	return run_one<CRC>(name, check_value, residue_const) + run_one_features<CRC>(name);
+}
+
+// Every mode and every feature of an algorithm of the representative subset.
+// Returns the number of errors.
+template <typename CRC, bool REFLECTED_CRC_REGISTER>
+int test_all_modes(const char* name, uint64_t check_value, uint64_t residue_const) {
+	using crc_t = crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT, CRC::XOR_OUT,
+		CRC::REF_IN, CRC::REF_OUT, REFLECTED_CRC_REGISTER>;
+
+	int errors = 0;
+	char new_name[0x80];
+
+	sprintf(new_name, "%s::%s", name, "tableless");
+	errors += run_one_all<typename crc_t::tableless>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "tableless_fast");
+	errors += run_one_all<typename crc_t::tableless_fast>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "table_based");
+	errors += run_one_all<typename crc_t::table_based>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "small_table_based");
+	errors += run_one_all<typename crc_t::small_table_based>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "ext_table_based");
+	errors += run_one_all<etb<typename crc_t::ext_table_based>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "ext_small_table_based");
+	errors += run_one_all<etb<typename crc_t::ext_small_table_based>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "sliced_table_based<8>");
+	errors += run_one_all<typename crc_t::template sliced_table_based<8>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "sliced_table_based<16>");
+	errors += run_one_all<typename crc_t::template sliced_table_based<16>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "ext_sliced_table_based<16>");
+	errors += run_one_all<etb<typename crc_t::template ext_sliced_table_based<16>>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "interleaved_table_based<3>");
+	errors += run_one_all<typename crc_t::template interleaved_table_based<3>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "ext_interleaved_table_based<4>");
+	errors += run_one_all<etb<typename crc_t::template ext_interleaved_table_based<4>>>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "pre_reflected_table_based");
+	errors += run_one_all<typename crc_t::pre_reflected_table_based>(new_name, check_value, residue_const);
+
+	sprintf(new_name, "%s::%s", name, "hw_accelerated");
+	errors += run_one_all<typename crc_t::hw_accelerated>(new_name, check_value, residue_const);
+	errors += test_large_input<typename crc_t::hw_accelerated>(new_name);
+
+	return errors;
+}
+
+// A constexpr input that is long enough for the block based code paths.
+struct long_test_data {
+	uint8_t bytes[600];
+	constexpr long_test_data() : bytes() {
+		for (int i=0; i<600; i++)
+			bytes[i] = uint8_t(i * 7 + 3);
+	}
+};
+
+// Executes the tasks of parallel_calculate() serially in reverse order.
+struct reverse_serial_executor {
+	template <typename TASK>
+	void operator()(size_t num_tasks, const TASK& task) const {
+		for (size_t i=num_tasks; i>0; i--)
+			task(i-1);
+	}
+};
+
+// Returns the number of errors.
+template <typename CRC>
+int test_parallel(const char* name) {
+	uint8_t data[1000];
+	for (size_t i=0; i<sizeof(data); i++)
+		data[i] = uint8_t(i * 7 + 3);
+
+	int errors = 0;
+	static const size_t SIZES[] = { 0, 1, 9, 100, 999, 1000 };
+	static const size_t MAX_TASKS[] = { 1, 2, 3, 64, 100 };
+	for (size_t size : SIZES) {
+		auto expected = CRC::calculate(data, size);
+		for (size_t max_tasks : MAX_TASKS) {
+			auto v = CRC::parallel_calculate(data, size, reverse_serial_executor(), max_tasks, 1);
+			if (v != expected) {
+				printf("%s::parallel_calculate() size=%d max_tasks=%d output=%" PRIx64 " expected=%" PRIx64 " fail\n",
+					name, int(size), int(max_tasks), (uint64_t)v, (uint64_t)expected);
+				errors++;
+			}
+		}
+#ifdef PARAMETRIC_CRC_THREADS
+		auto v = CRC::hw_accelerated::parallel_calculate(data, size, crc::thread_executor(), 4, 16);
+		if (v != expected) {
+			printf("%s::hw_accelerated::parallel_calculate() size=%d output=%" PRIx64 " expected=%" PRIx64 " fail\n",
+				name, int(size), (uint64_t)v, (uint64_t)expected);
+			errors++;
+		}
+#endif
+	}
+	return errors;
+}
+
+// Appends the CRC of the first size bytes of p in the byte order that
+// forms a valid codeword.
+template <typename CRC>
+void append_crc(uint8_t* p, size_t size) {
+	auto crc_val = CRC::calculate(p, size);
+	if (CRC::REF_IN != CRC::REF_OUT)
+		crc_val = crc::reverse_bits(crc_val);
+	for (size_t i=0; i<sizeof(crc_val); i++) {
+		int shift = CRC::REF_IN ? int(i*8) : int((sizeof(crc_val)-1-i)*8);
+		p[size + i] = uint8_t(crc_val >> shift);
+	}
+}
+
+// Compares the output of calculate_batch() with that of calculate().
+// Returns the number of errors.
+template <typename CRC>
+int test_batch_mode(const char* name) {
+	using T = typename CRC::value_type;
+	static constexpr size_t N = 23;
+	uint8_t data[N * 40];
+	for (size_t i=0; i<sizeof(data); i++)
+		data[i] = uint8_t(i * 13 + 5);
+
+	// sizes in random order including empty messages
+	const void* ptrs[N];
+	size_t sizes[N];
+	for (size_t i=0; i<N; i++) {
+		sizes[i] = i % 5 == 0 ? 0 : (i * 17) % 41;
+		ptrs[i] = data + i * 40;
+	}
+
+	int errors = 0;
+	T out[N];
+	for (size_t n=0; n<=N; n+=(n<6 ? 1 : 17)) {
+		CRC::calculate_batch(ptrs, sizes, out, n);
+		for (size_t i=0; i<n; i++) {
+			if (out[i] != CRC::calculate(ptrs[i], sizes[i])) {
+				printf("%s::calculate_batch() n=%d i=%d fail\n", name, int(n), int(i));
+				errors++;
+			}
+		}
+		CRC::calculate_batch(data, 33, 40, out, n);
+		for (size_t i=0; i<n; i++) {
+			if (out[i] != CRC::calculate(data + i * 40, 33)) {
+				printf("%s::calculate_batch() strided n=%d i=%d fail\n", name, int(n), int(i));
+				errors++;
+			}
+		}
+	}
+
+	// verify_batch() with more codewords than VERIFY_BATCH_BLOCK_SIZE and
+	// every 7th of them corrupted
+	static constexpr size_t NUM_CODEWORDS = crc::VERIFY_BATCH_BLOCK_SIZE + 9;
+	static constexpr size_t STRIDE = 16 + sizeof(T);
+	uint8_t codewords[NUM_CODEWORDS * STRIDE];
+	const void* codeword_ptrs[NUM_CODEWORDS];
+	size_t codeword_sizes[NUM_CODEWORDS];
+	bool valid[NUM_CODEWORDS], valid_strided[NUM_CODEWORDS];
+	size_t expected_valid = 0;
+	for (size_t i=0; i<NUM_CODEWORDS; i++) {
+		uint8_t* p = codewords + i * STRIDE;
+		for (size_t j=0; j<16; j++)
+			p[j] = uint8_t(i * 7 + j * 3);
+		append_crc<CRC>(p, 16);
+		if (i % 7 == 3)
+			p[i % 16] ^= 0x10;
+		else
+			expected_valid++;
+		codeword_ptrs[i] = p;
+		codeword_sizes[i] = STRIDE;
+	}
+	size_t num_valid = CRC::verify_batch(codeword_ptrs, codeword_sizes, valid, NUM_CODEWORDS);
+	size_t num_valid_strided = CRC::verify_batch(codewords, STRIDE, STRIDE, valid_strided, NUM_CODEWORDS);
+	if (num_valid != expected_valid || num_valid_strided != expected_valid) {
+		printf("%s::verify_batch() num_valid=%d num_valid_strided=%d expected=%d fail\n",
+			name, int(num_valid), int(num_valid_strided), int(expected_valid));
+		errors++;
+	}
+	for (size_t i=0; i<NUM_CODEWORDS; i++) {
+		if (valid[i] != (i % 7 != 3) || valid_strided[i] != valid[i]) {
+			printf("%s::verify_batch() i=%d fail\n", name, int(i));
+			errors++;
+		}
+	}
+	return errors;
+}
+
+// Compares the fixed size key hashing with calculate().
+template <typename CRC, bool REFLECTED_CRC_REGISTER>
+int test_hash_ref_reg(const char* name) {
+	using crc_t = crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT, CRC::XOR_OUT,
+		CRC::REF_IN, CRC::REF_OUT, REFLECTED_CRC_REGISTER>;
+	using T = typename crc_t::value_type;
+
+	uint8_t key[16];
+	for (size_t i=0; i<sizeof(key); i++)
+		key[i] = uint8_t(i * 29 + 3);
+	uint32_t key_32 = 0x04030201;
+	uint64_t key_64 = 0x0807060504030201;
+	const uint8_t key_bytes[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	crc::hasher<crc_t, uint64_t> hasher;
+	T expected_64 = crc_t::calculate(&key_64, 8);
+	bool ok = crc_t::template hash_fixed<1>(key) == crc_t::calculate(key, 1) &&
+		crc_t::template hash_fixed<3>(key) == crc_t::calculate(key, 3) &&
+		crc_t::template hash_fixed<16>(key) == crc_t::calculate(key, 16) &&
+		crc_t::template hash_fixed<16>((const void*)key) == crc_t::calculate(key, 16) &&
+		crc_t::hash_u32(key_32) == crc_t::calculate(key_bytes, 4) &&
+		crc_t::hash_u64(key_64) == crc_t::calculate(key_bytes, 8) &&
+		T(hasher(key_64)) == expected_64;
+	if (!ok) {
+		printf("%s hash ref_reg=%d fail\n", name, int(REFLECTED_CRC_REGISTER));
+		return 1;
+	}
+	return 0;
+}
+
+// Returns the number of errors.
+template <typename CRC>
+int test_hash(const char* name) {
+	return test_hash_ref_reg<CRC, false>(name) + test_hash_ref_reg<CRC, true>(name);
+}
+
+// Compares crc::dynamic with the template based implementation with both
+// REF_REG settings. Returns the number of errors.
+template <typename CRC>
+int test_dynamic(const char* name) {
+	uint8_t data[300];
+	for (size_t i=0; i<sizeof(data); i++)
+		data[i] = uint8_t(i * 11 + 1);
+	auto expected = CRC::calculate(data, sizeof(data));
+
+	int errors = 0;
+	for (int ref_reg=0; ref_reg<2; ref_reg++) {
+		crc::dynamic_cfg cfg = { CRC::WIDTH, CRC::POLY, CRC::INIT, CRC::XOR_OUT,
+			CRC::REF_IN, CRC::REF_OUT, ref_reg != 0 };
+		crc::dynamic crc_obj(cfg);
+		crc_obj.update(data, 100);
+		crc_obj.update(data + 100, 200);
+		crc::dynamic copy = crc_obj;
+		if (crc_obj.final() != expected || copy.final() != expected ||
+				crc_obj.calculate(data, sizeof(data)) != expected || !crc_obj.table_based()) {
+			printf("%s crc::dynamic ref_reg=%d output=%" PRIx64 " expected=%" PRIx64 " fail\n",
+				name, ref_reg, crc_obj.final(), (uint64_t)expected);
+			errors++;
+		}
+		crc_obj.reset();
+		crc_obj.update("123456789", 9);
+		if (crc_obj.residue() != (typename CRC::value_type)crc_obj.residue() ||
+				crc_obj.final() != CRC::calculate("123456789", 9)) {
+			printf("%s crc::dynamic ref_reg=%d reset() fail\n", name, ref_reg);
+			errors++;
+		}
+	}
+	return errors;
+}
+
+// Creates more crc::dynamic instances with different tables than the size of
+// the table cache. Returns the number of errors.
+int test_dynamic_cache() {
+	static constexpr int N = PARAMETRIC_CRC_DYNAMIC_CACHE_SIZE + 2;
+	int errors = 0;
+	for (int round=0; round<2; round++) {
+		crc::dynamic* objects[N];
+		for (int i=0; i<N; i++) {
+			// CRC-16/KERMIT parameters with different polynomials
+			crc::dynamic_cfg cfg = { 16, uint64_t(0x1021 + 2 * i), 0, 0, true, true, true };
+			objects[i] = new crc::dynamic(cfg);
+			bool expected_table_based = i < PARAMETRIC_CRC_DYNAMIC_CACHE_SIZE;
+			if (objects[i]->table_based() != expected_table_based) {
+				printf("crc::dynamic cache: round=%d i=%d table_based=%d fail\n",
+					round, i, int(objects[i]->table_based()));
+				errors++;
+			}
+		}
+		crc::dynamic_cfg cfg = objects[N-1]->cfg();
+		uint64_t tableless_result = objects[N-1]->calculate("123456789", 9);
+		for (int i=0; i<N; i++)
+			delete objects[i];
+
+		// the released tables can be evicted
+		crc::dynamic crc_obj(cfg);
+		if (!crc_obj.table_based() || crc_obj.calculate("123456789", 9) != tableless_result) {
+			printf("crc::dynamic cache: round=%d eviction fail\n", round);
+			errors++;
+		}
+	}
+
+#ifdef PARAMETRIC_CRC_THREADS
+	// Threads acquiring the same new table at the same time: one of them
+	// generates it and the others wait until it is ready.
+	{
+		using expected_crc = crc::parametric<32, 0x12345679, 0xffffffff, 0, false, true, true>;
+		static constexpr int NUM_THREADS = 4;
+		const crc::dynamic_cfg cfg = { 32, 0x12345679, 0xffffffff, 0, false, true, true };
+		const uint64_t expected = expected_crc::calculate("123456789", 9);
+		bool ok[NUM_THREADS] = {};
+		std::thread threads[NUM_THREADS];
+		for (int i=0; i<NUM_THREADS; i++) {
+			threads[i] = std::thread([&cfg, &ok, expected, i] {
+				crc::dynamic crc_obj(cfg);
+				ok[i] = crc_obj.table_based() && crc_obj.calculate("123456789", 9) == expected;
+			});
+		}
+		for (int i=0; i<NUM_THREADS; i++) {
+			threads[i].join();
+			if (!ok[i]) {
+				printf("crc::dynamic cache: thread=%d fail\n", i);
+				errors++;
+			}
+		}
+	}
+#endif
+	return errors;
+}
+
+#ifdef PARAMETRIC_CRC_THREADS
+// Feeds buffers of various sizes through a crc::pipeline with 2 and 3
+// buffers and compares the result with calculate(). Returns the number of
+// errors.
+template <typename CRC>
+int test_pipeline(const char* name) {
+	uint8_t data[5000];
+	for (size_t i=0; i<sizeof(data); i++)
+		data[i] = uint8_t(i * 11 + 1);
+	auto expected = CRC::calculate(data, sizeof(data));
+
+	int errors = 0;
+	for (size_t num_buffers=2; num_buffers<=3; num_buffers++) {
+		crc::pipeline<CRC> stage(num_buffers, 300);
+		for (size_t pos=0, len=0; pos<sizeof(data); pos+=len, len=(len*5+17)%stage.buffer_size()) {
+			if (len > sizeof(data) - pos)
+				len = sizeof(data) - pos;
+			uint8_t* buf = stage.acquire();
+			memcpy(buf, data + pos, len);
+			stage.submit(len);
+		}
+		auto v = stage.final();
+		if (v != expected) {
+			printf("crc::pipeline<%s> num_buffers=%d output=%" PRIx64 " expected=%" PRIx64 " fail\n",
+				name, int(num_buffers), (uint64_t)v, (uint64_t)expected);
+			errors++;
+		}
+	}
+	return errors;
+}
+#endif
+
+// Returns the number of errors.
+template <typename CRC>
+int test_batch(const char* name) {
+	using crc_ref_reg = crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT, CRC::XOR_OUT,
+		CRC::REF_IN, CRC::REF_OUT, !CRC::REF_IN>;
+	int errors = test_batch_mode<typename CRC::table_based>(name)
+		+ test_batch_mode<typename CRC::tableless>(name)
+		+ test_batch_mode<typename CRC::tableless_fast>(name)
+		+ test_batch_mode<typename CRC::hw_accelerated>(name)
+		+ test_batch_mode<typename crc_ref_reg::small_table_based>(name);
+
+	using ext_crc = typename CRC::ext_table_based;
+	typename ext_crc::table_type table;
+	const uint8_t data[] = "123456789";
+	const void* ptrs[5] = { data, data, data, data, data };
+	size_t sizes[5] = { 9, 9, 9, 9, 9 };
+	typename CRC::value_type out[5], out_strided[5];
+	ext_crc::calculate_batch(ptrs, sizes, out, 5, table);
+	ext_crc::calculate_batch(data, 9, 0, out_strided, 5, table);
+	for (int i=0; i<5; i++) {
+		if (out[i] != CRC::calculate(data, 9) || out_strided[i] != CRC::calculate(data, 9)) {
+			printf("%s::ext_table_based::calculate_batch() fail\n", name);
+			errors++;
+		}
+	}
+	return errors;
+}
+
 template <typename CRC>
 constexpr bool test_constexpr(uint64_t check_value) {
 	constexpr uint8_t CHECK_DATA[] = "123456789";
@@ -201,10 +865,423 @@ constexpr bool test_constexpr(uint64_t check_value) {
 	return true;
 }
 
+// The compile time checks of the modes and features added on top of
+// test_constexpr() for the representative subset of the algorithms.
+template <typename CRC>
+constexpr bool test_constexpr_modes(uint64_t check_value) {
+	constexpr uint8_t CHECK_DATA[] = "123456789";
+
+	// Table-less calculation (the 9 bytes take the fallback to the bit-by-bit loop)
+	{
+		constexpr uint8_t STR[] = "123456789";
+		constexpr auto v = CRC::tableless_fast::calculate(STR, 9);
+		if (v != check_value) {
+			DEBUG_PRINTF("tableless_fast::calculate(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)check_value);
+			return false;
+		}
+	}
+
+	// Table-less calculation with the contributions of the bits
+	{
+		constexpr long_test_data DATA;
+		constexpr auto v = CRC::tableless_fast::calculate(DATA.bytes, 40);
+		constexpr auto expected = CRC::tableless::calculate(DATA.bytes, 40);
+		if (v != expected) {
+			DEBUG_PRINTF("tableless_fast::calculate() long: output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)expected);
+			return false;
+		}
+	}
+
+	// Slicing-by-8 (the 9 bytes of the input make up a block and a tail byte)
+	{
+		constexpr uint8_t STR[] = "123456789";
+		constexpr auto v = CRC::template sliced_table_based<8>::calculate(STR, 9);
+		if (v != check_value) {
+			DEBUG_PRINTF("sliced_table_based<8>::calculate(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)check_value);
+			return false;
+		}
+	}
+
+	// The hw_accelerated mode falls back to the table_based code at compile time
+	{
+		constexpr uint8_t STR[] = "123456789";
+		constexpr auto v = CRC::hw_accelerated::calculate(STR, 9);
+		if (v != check_value) {
+			DEBUG_PRINTF("hw_accelerated::calculate(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)check_value);
+			return false;
+		}
+	}
+
+	// Combining the CRCs of chunks calculated separately
+	{
+		constexpr uint8_t STR1[] = "12345";
+		constexpr uint8_t STR2[] = "6789";
+		auto v = CRC::combine(CRC::calculate(STR1, 5), CRC::calculate(STR2, 4), 4);
+		if (v != check_value) {
+			DEBUG_PRINTF("combine(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)check_value);
+			return false;
+		}
+		auto v2 = CRC::combine(CRC::calculate(CHECK_DATA, size_t(0)), CRC::calculate(CHECK_DATA, 9), 9);
+		auto v3 = CRC::combine(CRC::calculate(CHECK_DATA, 9), CRC::calculate(CHECK_DATA, size_t(0)), 0);
+		if (v2 != check_value || v3 != check_value) {
+			DEBUG_PRINTF("combine() with empty chunk: output=%" PRIx64 ",%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v2, (uint64_t)v3, (uint64_t)check_value);
+			return false;
+		}
+		typename CRC::ext_table_based::table_type table;
+		typename CRC::ext_table_based crc_a;
+		crc_a.update(STR1, 5, table);
+		typename CRC::ext_table_based crc_b;
+		crc_b.update(STR2, 4, table);
+		typename CRC::ext_table_based crc(
+			CRC::ext_table_based::combine_interim(crc_a.interim(), crc_b.interim(), 4));
+		if (crc.final() != check_value) {
+			DEBUG_PRINTF("combine_interim(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)crc.final(), (uint64_t)check_value);
+			return false;
+		}
+	}
+
+	// update_zeros() vs feeding zero bytes into the CRC
+	{
+		constexpr uint8_t ZEROS[100] = {};
+		CRC crc_1, crc_2;
+		crc_1.update(CHECK_DATA, 9);
+		crc_2.update(CHECK_DATA, 9);
+		for (int i=0; i<3; i++)
+			crc_1.update(ZEROS, 100);
+		crc_2.update_zeros(300);
+		if (crc_1.final() != crc_2.final()) {
+			DEBUG_PRINTF("update_zeros(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)crc_2.final(), (uint64_t)crc_1.final());
+			return false;
+		}
+	}
+
+	// Interleaved lanes (a block of 4*128 bytes and a tail)
+	{
+		constexpr long_test_data DATA;
+		constexpr auto v = CRC::template interleaved_table_based<4>::calculate(DATA.bytes, 600);
+		constexpr auto expected = CRC::calculate(DATA.bytes, 600);
+		if (v != expected) {
+			DEBUG_PRINTF("interleaved_table_based<4>::calculate(): output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)expected);
+			return false;
+		}
+	}
+
+	// REF_IN != REF_REG: blockwise input reversal and pre-reflected table
+	{
+		using crc_ref_reg = crc::parametric<CRC::WIDTH, CRC::POLY, CRC::INIT, CRC::XOR_OUT,
+			CRC::REF_IN, CRC::REF_OUT, !CRC::REF_IN>;
+		constexpr long_test_data DATA;
+		constexpr auto v = crc_ref_reg::calculate(DATA.bytes, 600);
+		constexpr auto v2 = crc_ref_reg::pre_reflected_table_based::calculate(DATA.bytes, 600);
+		constexpr auto expected = CRC::calculate(DATA.bytes, 600);
+		if (v != expected || v2 != expected) {
+			DEBUG_PRINTF("REF_IN != REF_REG: output=%" PRIx64 ",%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)v2, (uint64_t)expected);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+// Algorithms with the same POLY and REF_REG share their tables.
+using kermit_ref_reg = crc::parametric<16, 0x1021, 0x0000, 0x0000, true, true, true>;
+using xmodem_ref_reg = crc::parametric<16, 0x1021, 0x0000, 0x0000, false, false, true>;
+STATIC_ASSERT((crc::table_usage<crc16::kermit, crc16::xmodem, crc32::iscsi::hw_accelerated,
+	crc32::iscsi::tableless>::NUM_TABLES == 3), "table_usage");
+STATIC_ASSERT((crc::table_usage<crc16::kermit, crc16::xmodem, crc32::iscsi::hw_accelerated,
+	crc32::iscsi::tableless>::TABLE_BYTES == 512+512+1024), "table_usage");
+STATIC_ASSERT((crc::table_usage<kermit_ref_reg, xmodem_ref_reg, kermit_ref_reg::ext_table_based,
+	kermit_ref_reg::small_table_based>::NUM_TABLES == 2), "table_usage shared table");
+STATIC_ASSERT((crc::table_usage<crc32::iscsi::sliced_table_based<8>>::TABLE_BYTES == 8*1024), "table_usage");
+STATIC_ASSERT((crc::table_usage<crc8::smbus::small_table_based, crc16::kermit>::TABLE_BYTES == 32+512), "table_usage");
+STATIC_ASSERT((crc::table_usage<crc8::smbus::small_table_based, crc16::kermit>::PAYLOAD_BYTES == 32+512), "table_usage");
+STATIC_ASSERT((crc::table_usage<crc8::smbus::small_table_based, crc16::kermit>::PADDING_BYTES == 0), "table_usage");
+
+// Copies more than crc::COPY_BLOCK_SIZE bytes to unaligned destinations.
+// Returns the number of errors.
+template <typename CRC>
+int test_copy_and_update(const char* name) {
+	static uint8_t src[crc::COPY_BLOCK_SIZE * 2 + 100];
+	static uint8_t dst[sizeof(src) + 16];
+	for (size_t i=0; i<sizeof(src); i++)
+		src[i] = uint8_t(i * 7 + (i >> 8));
+	auto expected = CRC::calculate(src, sizeof(src));
+
+	int errors = 0;
+	for (size_t offset=0; offset<16; offset+=5) {
+		for (int nt=0; nt<2; nt++) {
+			memset(dst, 0, sizeof(dst));
+			CRC crc_obj;
+			if (nt)
+				crc_obj.copy_and_update_nt(dst + offset, src, sizeof(src));
+			else
+				crc_obj.copy_and_update(dst + offset, src, sizeof(src));
+			if (crc_obj.final() != expected || memcmp(dst + offset, src, sizeof(src))) {
+				printf("%s copy_and_update() offset=%d nt=%d fail\n", name, int(offset), nt);
+				errors++;
+			}
+		}
+	}
+	return errors;
+}
+
+#ifdef PARAMETRIC_CRC_STATS
+// Checks the thread-local counters of a mode after a few calls.
+// Returns the number of errors.
+int test_stats() {
+	using crc_t = crc16::kermit::tableless_fast;
+	crc::reset_thread_stats();
+	crc_t::calculate("123456789", 9);
+	crc_t crc_obj;
+	crc_obj.update("12", 2);
+	crc_obj.update("", 0);
+
+	const crc::stats& s = crc_t::thread_stats();
+	int found = 0;
+	crc::for_each_thread_stats([&](const crc::stats& entry) { found += &entry == &s; });
+	if (found != 1 || s.width != 16 || s.poly != 0x1021 || strcmp(s.mode, "tableless_fast") ||
+			s.calls != 3 || s.bytes != 11 || s.size_histogram[0] != 1 ||
+			s.size_histogram[2] != 1 || s.size_histogram[4] != 1) {
+		printf("crc::stats found=%d mode=%s calls=%d bytes=%d fail\n",
+			found, s.mode, int(s.calls), int(s.bytes));
+		return 1;
+	}
+
+	// patch() counts its modified bytes as a call
+	crc_t::patch(crc_t::calculate("123456789", 9), 9, 2, "345", "abc", 3);
+	if (s.calls != 5 || s.bytes != 23 || s.size_histogram[2] != 2) {
+		printf("crc::stats patch() calls=%d bytes=%d fail\n", int(s.calls), int(s.bytes));
+		return 1;
+	}
+	return 0;
+}
+#endif
+
+// The engine hw_accelerated is expected to pick with the detected CPU
+// features and an algorithm with or without a CRC instruction.
+crc::engine expected_engine(bool crc_instruction) {
+#if defined(PARAMETRIC_CRC_HW_X86) || defined(PARAMETRIC_CRC_HW_ARM64)
+	const crc::cpu_features& f = crc::get_cpu_features();
+	if (f.vpclmul)
+		return crc::engine::vpclmul;
+	if (f.pclmul)
+		return crc::engine::clmul;
+	if (crc_instruction)
+		return crc::engine::crc_instruction;
+#else
+	(void)crc_instruction;  // PARAMETRIC_CRC_NO_HW_ACCELERATION or no hw support
+#endif
+	return crc::engine::table_based;
+}
+
+// Checks the selected_engine() of hw_accelerated. Returns the number of errors.
+int test_selected_engine() {
+	int errors = 0;
+	const crc::cpu_features& f = crc::get_cpu_features();
+	struct { const char* name; crc::engine selected; crc::engine expected; } cases[] = {
+		{ "crc32::iscsi", crc32::iscsi::hw_accelerated::selected_engine(), expected_engine(f.crc32c) },
+		{ "crc32::iso_hdlc", crc32::iso_hdlc::hw_accelerated::selected_engine(), expected_engine(f.crc32) },
+		{ "crc16::xmodem", crc16::xmodem::hw_accelerated::selected_engine(), expected_engine(false) },
+	};
+	for (const auto& c : cases) {
+		if (c.selected != c.expected) {
+			printf("%s::hw_accelerated selected_engine()=%s expected=%s fail\n",
+				c.name, crc::engine_name(c.selected), crc::engine_name(c.expected));
+			errors++;
+		}
+	}
+	return errors;
+}
+
+// Compares the bulk reverse_bits() with the bytewise reverse_bits() at
+// various sizes and offsets. Returns the number of errors.
+int test_reverse_bits() {
+	uint8_t in[100], out[100];
+	for (size_t i=0; i<sizeof(in); i++)
+		in[i] = uint8_t(i * 131 + 7);
+	for (size_t offset=0; offset<4; offset++) {
+		for (size_t n=0; n+offset<=sizeof(in); n++) {
+			memset(out, 0, sizeof(out));
+			crc::reverse_bits(in + offset, out, n);
+			for (size_t i=0; i<sizeof(out); i++) {
+				if (out[i] != (i < n ? crc::reverse_bits(in[offset + i]) : 0)) {
+					printf("reverse_bits(in, out, %d) offset=%d i=%d fail\n", int(n), int(offset), int(i));
+					return 1;
+				}
+			}
+		}
+	}
+	return 0;
+}
+
+// A bump allocator for crc::create_table() and crc::table_replicas that
+// counts the allocations of each node and fails after max_bytes.
+struct test_arena {
+	alignas(64) uint8_t buf[3 * 16 * 256 * 8 + 1];
+	size_t used = 1;  // starts misaligned
+	size_t max_bytes = sizeof(buf);
+	int deallocations = 0;
+
+	void* allocate(size_t size, size_t alignment) {
+		size_t pos = (used + alignment - 1) / alignment * alignment;
+		if (pos + size > max_bytes)
+			return nullptr;
+		used = pos + size;
+		return buf + pos;
+	}
+	void* allocate(int, size_t size, size_t alignment) {
+		return allocate(size, alignment);
+	}
+	void deallocate(int, void*, size_t) {
+		deallocations++;
+	}
+};
+
+// Returns the number of errors.
+int test_table_allocation() {
+	int errors = 0;
+	using crc_t = crc32::iscsi::ext_sliced_table_based<16>;
+	auto is_aligned = [](const void* p) { return uintptr_t(p) % crc::table_alignment<uint32_t>::VALUE == 0; };
+	// with 64 byte alignment the 32 bytes of the small table of CRC-8 are
+	// aligned to 32 bytes
+	using small_table_t = crc8::smbus::small_table_based::table_type;
+	const void* small_table = crc::static_table<small_table_t>::instance.first_row;
+	if (uintptr_t(crc::static_table<crc16::kermit::table_type>::instance.entries) % crc::table_alignment<uint16_t>::VALUE != 0
+			|| uintptr_t(small_table) % small_table_t::ALIGNMENT != 0
+			|| (PARAMETRIC_CRC_TABLE_ALIGNMENT >= 64 && uintptr_t(small_table) % 64 + sizeof(small_table_t) > 64)) {
+		printf("static_table alignment fail\n");
+		errors++;
+	}
+
+	static test_arena arena;
+	crc_t::table_type* table = crc::create_table<crc_t::table_type>(arena);
+	if (!table || !is_aligned(table->rows) || crc_t::calculate("123456789", 9, *table) != 0xe3069283) {
+		printf("crc::create_table() fail\n");
+		errors++;
+	}
+
+	// room for two of the three replicas
+	arena.used = 1;
+	arena.max_bytes = 64 + 2 * sizeof(crc_t::table_type);
+	{
+		crc::table_replicas<crc_t::table_type, test_arena> replicas(3, arena);
+		for (int node=-1; node<=3; node++) {
+			bool expected_local = node == 0 || node == 1;
+			const auto& t = replicas.get(node);
+			if (replicas.is_local(node) != expected_local || !is_aligned(t.rows)
+					|| crc_t::calculate("123456789", 9, t) != 0xe3069283) {
+				printf("crc::table_replicas node=%d fail\n", node);
+				errors++;
+			}
+		}
+	}
+	if (arena.deallocations != 2) {
+		printf("crc::table_replicas deallocations=%d fail\n", arena.deallocations);
+		errors++;
+	}
+	return errors;
+}
+
+// The tables of zoo_a2eb come from test_tables.h, the output of table_gen.cpp
+// (see PARAMETRIC_CRC_EXTERN_TABLES). Its polynomial isn't in the catalog so
+// nothing else uses these tables.
+using zoo_a2eb = crc::parametric<16, 0xa2eb, 0xffff, 0xffff, true>;
+
+int test_extern_tables() {
+	int errors = 0;
+	const char* s = "The quick brown fox jumps over the lazy dog";
+	size_t size = strlen(s);
+	uint16_t expected = zoo_a2eb::tableless::calculate(s, size);
+	static const zoo_a2eb::ext_table_based::table_type ext_table(crc_generated_tables::table_0);
+	if (zoo_a2eb::table_based::calculate(s, size) != expected
+			|| zoo_a2eb::small_table_based::calculate(s, size) != expected
+			|| zoo_a2eb::sliced_table_based<8>::calculate(s, size) != expected
+			|| zoo_a2eb::ext_table_based::calculate(s, size, ext_table) != expected) {
+		printf("extern static_table fail\n");
+		errors++;
+	}
+	return errors;
+}
+
+constexpr bool test_multi_constexpr() {
+	constexpr uint8_t STR[] = "123456789";
+	crc::multi<crc16::kermit, crc32::iscsi, crc64::xz::tableless> crcs;
+	crcs.update(STR, 9);
+	return crcs.final<0>() == 0x2189 && crcs.final<1>() == 0xe3069283
+		&& crcs.final<2>() == 0x995dc9bbdf1939fa;
+}
+STATIC_ASSERT(test_multi_constexpr(), "crc::multi");
+
+int test_multi() {
+	int errors = 0;
+	static uint8_t data[3 * crc::MULTI_BLOCK_SIZE + 123];
+	uint32_t seed = 12345;
+	for (size_t i=0; i<sizeof(data); i++) {
+		seed = seed * 1103515245 + 12345;
+		data[i] = uint8_t(seed >> 16);
+	}
+	crc::multi<crc32::iso_hdlc::hw_accelerated, crc64::xz, crc32::iscsi::sliced_table_based<16>> crcs;
+	crcs.update(data, 1000);
+	crcs.update(data + 1000, sizeof(data) - 1000);
+	if (crcs.final<0>() != crc32::iso_hdlc::calculate(data, sizeof(data))
+			|| crcs.final<1>() != crc64::xz::calculate(data, sizeof(data))
+			|| crcs.final<2>() != crc32::iscsi::calculate(data, sizeof(data))) {
+		printf("crc::multi fail\n");
+		errors++;
+	}
+	return errors;
+}
+
+using namespace crc::literals;
+STATIC_ASSERT("123456789"_crc8 == 0xf4, "_crc8");
+STATIC_ASSERT("123456789"_crc16 == 0xbb3d, "_crc16");
+STATIC_ASSERT("123456789"_crc32 == 0xcbf43926, "_crc32");
+STATIC_ASSERT("123456789"_crc32c == 0xe3069283, "_crc32c");
+STATIC_ASSERT(crc32::castagnoli::hash_u32(0x34333231) == "1234"_crc32c, "hash_u32");
+STATIC_ASSERT("123456789"_crc64 == 0x6c40df5f0b497347, "_crc64");
+STATIC_ASSERT(""_crc32 == 0, "_crc32 empty");
+
+// The literals and PARAMETRIC_CRC_CONSTANT() are compared with the runtime
+// CRC of the same strings. Returns the number of errors.
+int test_literals() {
+	static const char* const NAMES[] = { "start", "stop", "status", "unknown" };
+	int errors = 0;
+	for (int i=0; i<4; i++) {
+		int index;
+		switch (crc32::iso_hdlc::calculate(NAMES[i], strlen(NAMES[i]))) {
+		case "start"_crc32: index = 0; break;
+		case "stop"_crc32: index = 1; break;
+		case "status"_crc32: index = 2; break;
+		default: index = 3; break;
+		}
+		if (index != i) {
+			printf("_crc32 switch: %s index=%d fail\n", NAMES[i], index);
+			errors++;
+		}
+	}
+	if (PARAMETRIC_CRC_CONSTANT(crc::calculate_string<crc16::xmodem>("status", 6))
+			!= crc16::xmodem::calculate("status", 6)) {
+		printf("PARAMETRIC_CRC_CONSTANT() fail\n");
+		errors++;
+	}
+	return errors;
+}
+
 int main() {
 	int errors = 0;
 
-	// This macro tests a CRC algorithm with both an unreflected and a reflected CRC register:
+	// This macro tests the baseline modes of a CRC algorithm with both an
+	// unreflected and a reflected CRC register:
 	#define TEST_CRC(name, check_value, residue_const) \
 		errors += test_modes<name,false>("        " #name, check_value, residue_const); \
 		errors += test_modes<name,true >("ref_reg " #name, check_value, residue_const); \
@@ -212,6 +1289,22 @@ int main() {
 		if (!test_constexpr<name>(check_value)) \
 			{ errors++; printf("test_constexpr<%s>() returned false\n", #name); }
 
+	// Every mode and feature of a CRC algorithm with both an unreflected and
+	// a reflected CRC register. Instantiating all of them for the whole
+	// catalogue would make the compilation of this test very slow so it is
+	// used with a representative subset: an algorithm per WIDTH and REF_IN
+	// plus the algorithms with CRC instructions.
+	#define TEST_CRC_ALL_MODES(name, check_value, residue_const) \
+		errors += test_all_modes<name,false>("        " #name, check_value, residue_const); \
+		errors += test_all_modes<name,true >("ref_reg " #name, check_value, residue_const); \
+		errors += test_parallel<name>(#name); \
+		errors += test_batch<name>(#name); \
+		errors += test_dynamic<name>(#name); \
+		errors += test_hash<name>(#name); \
+		STATIC_ASSERT(test_constexpr_modes<name>(check_value), #name " test_constexpr_modes"); \
+		if (!test_constexpr_modes<name>(check_value)) \
+			{ errors++; printf("test_constexpr_modes<%s>() returned false\n", #name); }
+
 	TEST_CRC(crc8::rohc, 0xd0, 0x00);
 	TEST_CRC(crc8::i_432_1, 0xa1, 0xac);
 	TEST_CRC(crc8::smbus, 0xf4, 0x00);
@@ -285,8 +1378,37 @@ int main() {
 	TEST_CRC(crc64::we, 0x62ec59e3f1a4f00a, 0xfcacbebd5931a992);
 	TEST_CRC(crc64::redis, 0xe9c6d914c4b8d9ca, 0x0000000000000000);
 
+	TEST_CRC_ALL_MODES(crc8::autosar, 0xdf, 0x42);
+	TEST_CRC_ALL_MODES(crc8::rohc, 0xd0, 0x00);
+	TEST_CRC_ALL_MODES(crc16::genibus, 0xd64e, 0x1d0f);
+	TEST_CRC_ALL_MODES(crc16::ibm_sdlc, 0x906e, 0xf0b8);
+	TEST_CRC_ALL_MODES(crc32::bzip2, 0xfc891918, 0xc704dd7b);
+	TEST_CRC_ALL_MODES(crc32::iso_hdlc, 0xcbf43926, 0xdebb20e3);
+	TEST_CRC_ALL_MODES(crc32::iscsi, 0xe3069283, 0xb798b438);
+	TEST_CRC_ALL_MODES(crc64::we, 0x62ec59e3f1a4f00a, 0xfcacbebd5931a992);
+	TEST_CRC_ALL_MODES(crc64::xz, 0x995dc9bbdf1939fa, 0x49958c9abd7d353f);
+
+	#undef TEST_CRC_ALL_MODES
 	#undef TEST_CRC
 
+	errors += test_dynamic_cache();
+	errors += test_literals();
+	errors += test_table_allocation();
+	errors += test_extern_tables();
+	errors += test_multi();
+	errors += test_reverse_bits();
+	errors += test_selected_engine();
+#ifdef PARAMETRIC_CRC_STATS
+	errors += test_stats();
+#endif
+	errors += test_copy_and_update<crc32::iscsi::hw_accelerated>("crc32::iscsi::hw_accelerated");
+	errors += test_copy_and_update<crc16::xmodem::sliced_table_based<8>>("crc16::xmodem::sliced_table_based<8>");
+#ifdef PARAMETRIC_CRC_THREADS
+	errors += test_pipeline<crc32::iscsi::hw_accelerated>("crc32::iscsi::hw_accelerated");
+	errors += test_pipeline<crc16::kermit>("crc16::kermit");
+	errors += test_pipeline<crc64::xz::tableless>("crc64::xz::tableless");
+#endif
+
 	if (errors) {
 		printf("Number of failed tests: %d\n", errors);
 		return 1;
@@ -5,6 +5,8 @@
 // "check" and "residue" values provided in the CRC catalogue:
 // https://reveng.sourceforge.io/crc-catalogue/all.htm
 
+// test_mini_opt.cpp builds this test with PARAMETRIC_CRC_MINI_SLICED and
+// PARAMETRIC_CRC_MINI_HW_CRC32C.
 #include "parametric_crc_mini.h"
 #include <stdio.h>
 #include <stdint.h>    // uint64_t
@@ -63,6 +65,23 @@ constexpr bool test_one(typename CRC::value_type check_value, typename CRC::valu
 		}
 	}
 
+	// A single calculate() call (8-byte blocks with PARAMETRIC_CRC_MINI_SLICED
+	// and PARAMETRIC_CRC_MINI_HW_CRC32C) vs bytewise update() calls
+	{
+		uint8_t buf[100] = {};
+		for (int i=0; i<100; i++)
+			buf[i] = uint8_t(i * 37 + 11);
+		CRC crc;
+		for (int i=0; i<100; i++)
+			crc.update(buf + i, 1);
+		auto v = CRC::calculate(buf, 100);
+		if (v != crc.final()) {
+			DEBUG_PRINTF("calculate() of 100 bytes: output=%" PRIx64 " expected=%" PRIx64 "\n",
+				(uint64_t)v, (uint64_t)crc.final());
+			return false;
+		}
+	}
+
 	// Checking the residue left by a valid codeword
 	{
 		auto cv_rb = CRC::REF_IN != CRC::REF_OUT ? crc::reverse_bits(check_value) : check_value;
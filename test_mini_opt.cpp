@@ -0,0 +1,13 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// Runs test_mini.cpp with the optional code paths of the mini header: the
+// slicing-by-8 tables and the CRC-32C instructions. The instructions are used
+// only if the compiler targets them, for example:
+//    g++ -std=c++14 -O2 -msse4.2 test_mini_opt.cpp -o test_mini_opt
+//    g++ -std=c++14 -O2 -march=armv8-a+crc test_mini_opt.cpp -o test_mini_opt
+//    cl /O2 /arch:AVX test_mini_opt.cpp
+
+#define PARAMETRIC_CRC_MINI_SLICED
+#define PARAMETRIC_CRC_MINI_HW_CRC32C
+#include "test_mini.cpp"
@@ -0,0 +1,9 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// Runs test.cpp with PARAMETRIC_CRC_STATS and PARAMETRIC_CRC_STATS_TIMING:
+// the calls of the tests are counted and test_stats() checks the counters.
+
+#define PARAMETRIC_CRC_STATS
+#define PARAMETRIC_CRC_STATS_TIMING
+#include "test.cpp"
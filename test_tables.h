@@ -0,0 +1,341 @@
+// Generated by table_gen: table:16:0xa2eb:1 small_table:16:0xa2eb:1 sliced8:16:0xa2eb:1
+//
+// Compile every translation unit with -DPARAMETRIC_CRC_EXTERN_TABLES='"<this file>"'
+// and define PARAMETRIC_CRC_DEFINE_TABLES in one of them (see table_gen.cpp).
+// Forgetting the former in a translation unit is an ODR violation.
+
+PARAMETRIC_CRC_EXTERN_STATIC_TABLE(crc::table<crc::tbl_cfg<16, 0xa2eb, true>>)
+PARAMETRIC_CRC_EXTERN_STATIC_TABLE(crc::small_table<crc::tbl_cfg<16, 0xa2eb, true>>)
+PARAMETRIC_CRC_EXTERN_STATIC_TABLE(crc::sliced_table<crc::tbl_cfg<16, 0xa2eb, true>, 8>)
+
+#ifdef PARAMETRIC_CRC_DEFINE_TABLES
+
+namespace crc_generated_tables {
+	constexpr crc::uint16 table_0[256] = {
+		0x0000, 0x1ea1, 0x3d42, 0x23e3, 0x7a84, 0x6425, 0x47c6, 0x5967,
+		0xf508, 0xeba9, 0xc84a, 0xd6eb, 0x8f8c, 0x912d, 0xb2ce, 0xac6f,
+		0x449b, 0x5a3a, 0x79d9, 0x6778, 0x3e1f, 0x20be, 0x035d, 0x1dfc,
+		0xb193, 0xaf32, 0x8cd1, 0x9270, 0xcb17, 0xd5b6, 0xf655, 0xe8f4,
+		0x8936, 0x9797, 0xb474, 0xaad5, 0xf3b2, 0xed13, 0xcef0, 0xd051,
+		0x7c3e, 0x629f, 0x417c, 0x5fdd, 0x06ba, 0x181b, 0x3bf8, 0x2559,
+		0xcdad, 0xd30c, 0xf0ef, 0xee4e, 0xb729, 0xa988, 0x8a6b, 0x94ca,
+		0x38a5, 0x2604, 0x05e7, 0x1b46, 0x4221, 0x5c80, 0x7f63, 0x61c2,
+		0xbce7, 0xa246, 0x81a5, 0x9f04, 0xc663, 0xd8c2, 0xfb21, 0xe580,
+		0x49ef, 0x574e, 0x74ad, 0x6a0c, 0x336b, 0x2dca, 0x0e29, 0x1088,
+		0xf87c, 0xe6dd, 0xc53e, 0xdb9f, 0x82f8, 0x9c59, 0xbfba, 0xa11b,
+		0x0d74, 0x13d5, 0x3036, 0x2e97, 0x77f0, 0x6951, 0x4ab2, 0x5413,
+		0x35d1, 0x2b70, 0x0893, 0x1632, 0x4f55, 0x51f4, 0x7217, 0x6cb6,
+		0xc0d9, 0xde78, 0xfd9b, 0xe33a, 0xba5d, 0xa4fc, 0x871f, 0x99be,
+		0x714a, 0x6feb, 0x4c08, 0x52a9, 0x0bce, 0x156f, 0x368c, 0x282d,
+		0x8442, 0x9ae3, 0xb900, 0xa7a1, 0xfec6, 0xe067, 0xc384, 0xdd25,
+		0xd745, 0xc9e4, 0xea07, 0xf4a6, 0xadc1, 0xb360, 0x9083, 0x8e22,
+		0x224d, 0x3cec, 0x1f0f, 0x01ae, 0x58c9, 0x4668, 0x658b, 0x7b2a,
+		0x93de, 0x8d7f, 0xae9c, 0xb03d, 0xe95a, 0xf7fb, 0xd418, 0xcab9,
+		0x66d6, 0x7877, 0x5b94, 0x4535, 0x1c52, 0x02f3, 0x2110, 0x3fb1,
+		0x5e73, 0x40d2, 0x6331, 0x7d90, 0x24f7, 0x3a56, 0x19b5, 0x0714,
+		0xab7b, 0xb5da, 0x9639, 0x8898, 0xd1ff, 0xcf5e, 0xecbd, 0xf21c,
+		0x1ae8, 0x0449, 0x27aa, 0x390b, 0x606c, 0x7ecd, 0x5d2e, 0x438f,
+		0xefe0, 0xf141, 0xd2a2, 0xcc03, 0x9564, 0x8bc5, 0xa826, 0xb687,
+		0x6ba2, 0x7503, 0x56e0, 0x4841, 0x1126, 0x0f87, 0x2c64, 0x32c5,
+		0x9eaa, 0x800b, 0xa3e8, 0xbd49, 0xe42e, 0xfa8f, 0xd96c, 0xc7cd,
+		0x2f39, 0x3198, 0x127b, 0x0cda, 0x55bd, 0x4b1c, 0x68ff, 0x765e,
+		0xda31, 0xc490, 0xe773, 0xf9d2, 0xa0b5, 0xbe14, 0x9df7, 0x8356,
+		0xe294, 0xfc35, 0xdfd6, 0xc177, 0x9810, 0x86b1, 0xa552, 0xbbf3,
+		0x179c, 0x093d, 0x2ade, 0x347f, 0x6d18, 0x73b9, 0x505a, 0x4efb,
+		0xa60f, 0xb8ae, 0x9b4d, 0x85ec, 0xdc8b, 0xc22a, 0xe1c9, 0xff68,
+		0x5307, 0x4da6, 0x6e45, 0x70e4, 0x2983, 0x3722, 0x14c1, 0x0a60,
+	};
+} // namespace crc_generated_tables
+const crc::table<crc::tbl_cfg<16, 0xa2eb, true>> crc::static_table<crc::table<crc::tbl_cfg<16, 0xa2eb, true>>>::instance(crc_generated_tables::table_0);
+
+namespace crc_generated_tables {
+	constexpr crc::uint16 table_1_first_row[16] = {
+		0x0000, 0x1ea1, 0x3d42, 0x23e3, 0x7a84, 0x6425, 0x47c6, 0x5967,
+		0xf508, 0xeba9, 0xc84a, 0xd6eb, 0x8f8c, 0x912d, 0xb2ce, 0xac6f,
+	};
+	constexpr crc::uint16 table_1_first_column[16] = {
+		0x0000, 0x449b, 0x8936, 0xcdad, 0xbce7, 0xf87c, 0x35d1, 0x714a,
+		0xd745, 0x93de, 0x5e73, 0x1ae8, 0x6ba2, 0x2f39, 0xe294, 0xa60f,
+	};
+} // namespace crc_generated_tables
+const crc::small_table<crc::tbl_cfg<16, 0xa2eb, true>> crc::static_table<crc::small_table<crc::tbl_cfg<16, 0xa2eb, true>>>::instance(crc_generated_tables::table_1_first_row, crc_generated_tables::table_1_first_column);
+
+namespace crc_generated_tables {
+	constexpr crc::uint16 table_2[8][256] = {
+		{
+			0x0000, 0x1ea1, 0x3d42, 0x23e3, 0x7a84, 0x6425, 0x47c6, 0x5967,
+			0xf508, 0xeba9, 0xc84a, 0xd6eb, 0x8f8c, 0x912d, 0xb2ce, 0xac6f,
+			0x449b, 0x5a3a, 0x79d9, 0x6778, 0x3e1f, 0x20be, 0x035d, 0x1dfc,
+			0xb193, 0xaf32, 0x8cd1, 0x9270, 0xcb17, 0xd5b6, 0xf655, 0xe8f4,
+			0x8936, 0x9797, 0xb474, 0xaad5, 0xf3b2, 0xed13, 0xcef0, 0xd051,
+			0x7c3e, 0x629f, 0x417c, 0x5fdd, 0x06ba, 0x181b, 0x3bf8, 0x2559,
+			0xcdad, 0xd30c, 0xf0ef, 0xee4e, 0xb729, 0xa988, 0x8a6b, 0x94ca,
+			0x38a5, 0x2604, 0x05e7, 0x1b46, 0x4221, 0x5c80, 0x7f63, 0x61c2,
+			0xbce7, 0xa246, 0x81a5, 0x9f04, 0xc663, 0xd8c2, 0xfb21, 0xe580,
+			0x49ef, 0x574e, 0x74ad, 0x6a0c, 0x336b, 0x2dca, 0x0e29, 0x1088,
+			0xf87c, 0xe6dd, 0xc53e, 0xdb9f, 0x82f8, 0x9c59, 0xbfba, 0xa11b,
+			0x0d74, 0x13d5, 0x3036, 0x2e97, 0x77f0, 0x6951, 0x4ab2, 0x5413,
+			0x35d1, 0x2b70, 0x0893, 0x1632, 0x4f55, 0x51f4, 0x7217, 0x6cb6,
+			0xc0d9, 0xde78, 0xfd9b, 0xe33a, 0xba5d, 0xa4fc, 0x871f, 0x99be,
+			0x714a, 0x6feb, 0x4c08, 0x52a9, 0x0bce, 0x156f, 0x368c, 0x282d,
+			0x8442, 0x9ae3, 0xb900, 0xa7a1, 0xfec6, 0xe067, 0xc384, 0xdd25,
+			0xd745, 0xc9e4, 0xea07, 0xf4a6, 0xadc1, 0xb360, 0x9083, 0x8e22,
+			0x224d, 0x3cec, 0x1f0f, 0x01ae, 0x58c9, 0x4668, 0x658b, 0x7b2a,
+			0x93de, 0x8d7f, 0xae9c, 0xb03d, 0xe95a, 0xf7fb, 0xd418, 0xcab9,
+			0x66d6, 0x7877, 0x5b94, 0x4535, 0x1c52, 0x02f3, 0x2110, 0x3fb1,
+			0x5e73, 0x40d2, 0x6331, 0x7d90, 0x24f7, 0x3a56, 0x19b5, 0x0714,
+			0xab7b, 0xb5da, 0x9639, 0x8898, 0xd1ff, 0xcf5e, 0xecbd, 0xf21c,
+			0x1ae8, 0x0449, 0x27aa, 0x390b, 0x606c, 0x7ecd, 0x5d2e, 0x438f,
+			0xefe0, 0xf141, 0xd2a2, 0xcc03, 0x9564, 0x8bc5, 0xa826, 0xb687,
+			0x6ba2, 0x7503, 0x56e0, 0x4841, 0x1126, 0x0f87, 0x2c64, 0x32c5,
+			0x9eaa, 0x800b, 0xa3e8, 0xbd49, 0xe42e, 0xfa8f, 0xd96c, 0xc7cd,
+			0x2f39, 0x3198, 0x127b, 0x0cda, 0x55bd, 0x4b1c, 0x68ff, 0x765e,
+			0xda31, 0xc490, 0xe773, 0xf9d2, 0xa0b5, 0xbe14, 0x9df7, 0x8356,
+			0xe294, 0xfc35, 0xdfd6, 0xc177, 0x9810, 0x86b1, 0xa552, 0xbbf3,
+			0x179c, 0x093d, 0x2ade, 0x347f, 0x6d18, 0x73b9, 0x505a, 0x4efb,
+			0xa60f, 0xb8ae, 0x9b4d, 0x85ec, 0xdc8b, 0xc22a, 0xe1c9, 0xff68,
+			0x5307, 0x4da6, 0x6e45, 0x70e4, 0x2983, 0x3722, 0x14c1, 0x0a60,
+		},
+		{
+			0x0000, 0x40cc, 0x8198, 0xc154, 0xadbb, 0xed77, 0x2c23, 0x6cef,
+			0xf5fd, 0xb531, 0x7465, 0x34a9, 0x5846, 0x188a, 0xd9de, 0x9912,
+			0x4571, 0x05bd, 0xc4e9, 0x8425, 0xe8ca, 0xa806, 0x6952, 0x299e,
+			0xb08c, 0xf040, 0x3114, 0x71d8, 0x1d37, 0x5dfb, 0x9caf, 0xdc63,
+			0x8ae2, 0xca2e, 0x0b7a, 0x4bb6, 0x2759, 0x6795, 0xa6c1, 0xe60d,
+			0x7f1f, 0x3fd3, 0xfe87, 0xbe4b, 0xd2a4, 0x9268, 0x533c, 0x13f0,
+			0xcf93, 0x8f5f, 0x4e0b, 0x0ec7, 0x6228, 0x22e4, 0xe3b0, 0xa37c,
+			0x3a6e, 0x7aa2, 0xbbf6, 0xfb3a, 0x97d5, 0xd719, 0x164d, 0x5681,
+			0xbb4f, 0xfb83, 0x3ad7, 0x7a1b, 0x16f4, 0x5638, 0x976c, 0xd7a0,
+			0x4eb2, 0x0e7e, 0xcf2a, 0x8fe6, 0xe309, 0xa3c5, 0x6291, 0x225d,
+			0xfe3e, 0xbef2, 0x7fa6, 0x3f6a, 0x5385, 0x1349, 0xd21d, 0x92d1,
+			0x0bc3, 0x4b0f, 0x8a5b, 0xca97, 0xa678, 0xe6b4, 0x27e0, 0x672c,
+			0x31ad, 0x7161, 0xb035, 0xf0f9, 0x9c16, 0xdcda, 0x1d8e, 0x5d42,
+			0xc450, 0x849c, 0x45c8, 0x0504, 0x69eb, 0x2927, 0xe873, 0xa8bf,
+			0x74dc, 0x3410, 0xf544, 0xb588, 0xd967, 0x99ab, 0x58ff, 0x1833,
+			0x8121, 0xc1ed, 0x00b9, 0x4075, 0x2c9a, 0x6c56, 0xad02, 0xedce,
+			0xd815, 0x98d9, 0x598d, 0x1941, 0x75ae, 0x3562, 0xf436, 0xb4fa,
+			0x2de8, 0x6d24, 0xac70, 0xecbc, 0x8053, 0xc09f, 0x01cb, 0x4107,
+			0x9d64, 0xdda8, 0x1cfc, 0x5c30, 0x30df, 0x7013, 0xb147, 0xf18b,
+			0x6899, 0x2855, 0xe901, 0xa9cd, 0xc522, 0x85ee, 0x44ba, 0x0476,
+			0x52f7, 0x123b, 0xd36f, 0x93a3, 0xff4c, 0xbf80, 0x7ed4, 0x3e18,
+			0xa70a, 0xe7c6, 0x2692, 0x665e, 0x0ab1, 0x4a7d, 0x8b29, 0xcbe5,
+			0x1786, 0x574a, 0x961e, 0xd6d2, 0xba3d, 0xfaf1, 0x3ba5, 0x7b69,
+			0xe27b, 0xa2b7, 0x63e3, 0x232f, 0x4fc0, 0x0f0c, 0xce58, 0x8e94,
+			0x635a, 0x2396, 0xe2c2, 0xa20e, 0xcee1, 0x8e2d, 0x4f79, 0x0fb5,
+			0x96a7, 0xd66b, 0x173f, 0x57f3, 0x3b1c, 0x7bd0, 0xba84, 0xfa48,
+			0x262b, 0x66e7, 0xa7b3, 0xe77f, 0x8b90, 0xcb5c, 0x0a08, 0x4ac4,
+			0xd3d6, 0x931a, 0x524e, 0x1282, 0x7e6d, 0x3ea1, 0xfff5, 0xbf39,
+			0xe9b8, 0xa974, 0x6820, 0x28ec, 0x4403, 0x04cf, 0xc59b, 0x8557,
+			0x1c45, 0x5c89, 0x9ddd, 0xdd11, 0xb1fe, 0xf132, 0x3066, 0x70aa,
+			0xacc9, 0xec05, 0x2d51, 0x6d9d, 0x0172, 0x41be, 0x80ea, 0xc026,
+			0x5934, 0x19f8, 0xd8ac, 0x9860, 0xf48f, 0xb443, 0x7517, 0x35db,
+		},
+		{
+			0x0000, 0xe46e, 0x6657, 0x8239, 0xccae, 0x28c0, 0xaaf9, 0x4e97,
+			0x37d7, 0xd3b9, 0x5180, 0xb5ee, 0xfb79, 0x1f17, 0x9d2e, 0x7940,
+			0x6fae, 0x8bc0, 0x09f9, 0xed97, 0xa300, 0x476e, 0xc557, 0x2139,
+			0x5879, 0xbc17, 0x3e2e, 0xda40, 0x94d7, 0x70b9, 0xf280, 0x16ee,
+			0xdf5c, 0x3b32, 0xb90b, 0x5d65, 0x13f2, 0xf79c, 0x75a5, 0x91cb,
+			0xe88b, 0x0ce5, 0x8edc, 0x6ab2, 0x2425, 0xc04b, 0x4272, 0xa61c,
+			0xb0f2, 0x549c, 0xd6a5, 0x32cb, 0x7c5c, 0x9832, 0x1a0b, 0xfe65,
+			0x8725, 0x634b, 0xe172, 0x051c, 0x4b8b, 0xafe5, 0x2ddc, 0xc9b2,
+			0x1033, 0xf45d, 0x7664, 0x920a, 0xdc9d, 0x38f3, 0xbaca, 0x5ea4,
+			0x27e4, 0xc38a, 0x41b3, 0xa5dd, 0xeb4a, 0x0f24, 0x8d1d, 0x6973,
+			0x7f9d, 0x9bf3, 0x19ca, 0xfda4, 0xb333, 0x575d, 0xd564, 0x310a,
+			0x484a, 0xac24, 0x2e1d, 0xca73, 0x84e4, 0x608a, 0xe2b3, 0x06dd,
+			0xcf6f, 0x2b01, 0xa938, 0x4d56, 0x03c1, 0xe7af, 0x6596, 0x81f8,
+			0xf8b8, 0x1cd6, 0x9eef, 0x7a81, 0x3416, 0xd078, 0x5241, 0xb62f,
+			0xa0c1, 0x44af, 0xc696, 0x22f8, 0x6c6f, 0x8801, 0x0a38, 0xee56,
+			0x9716, 0x7378, 0xf141, 0x152f, 0x5bb8, 0xbfd6, 0x3def, 0xd981,
+			0x2066, 0xc408, 0x4631, 0xa25f, 0xecc8, 0x08a6, 0x8a9f, 0x6ef1,
+			0x17b1, 0xf3df, 0x71e6, 0x9588, 0xdb1f, 0x3f71, 0xbd48, 0x5926,
+			0x4fc8, 0xaba6, 0x299f, 0xcdf1, 0x8366, 0x6708, 0xe531, 0x015f,
+			0x781f, 0x9c71, 0x1e48, 0xfa26, 0xb4b1, 0x50df, 0xd2e6, 0x3688,
+			0xff3a, 0x1b54, 0x996d, 0x7d03, 0x3394, 0xd7fa, 0x55c3, 0xb1ad,
+			0xc8ed, 0x2c83, 0xaeba, 0x4ad4, 0x0443, 0xe02d, 0x6214, 0x867a,
+			0x9094, 0x74fa, 0xf6c3, 0x12ad, 0x5c3a, 0xb854, 0x3a6d, 0xde03,
+			0xa743, 0x432d, 0xc114, 0x257a, 0x6bed, 0x8f83, 0x0dba, 0xe9d4,
+			0x3055, 0xd43b, 0x5602, 0xb26c, 0xfcfb, 0x1895, 0x9aac, 0x7ec2,
+			0x0782, 0xe3ec, 0x61d5, 0x85bb, 0xcb2c, 0x2f42, 0xad7b, 0x4915,
+			0x5ffb, 0xbb95, 0x39ac, 0xddc2, 0x9355, 0x773b, 0xf502, 0x116c,
+			0x682c, 0x8c42, 0x0e7b, 0xea15, 0xa482, 0x40ec, 0xc2d5, 0x26bb,
+			0xef09, 0x0b67, 0x895e, 0x6d30, 0x23a7, 0xc7c9, 0x45f0, 0xa19e,
+			0xd8de, 0x3cb0, 0xbe89, 0x5ae7, 0x1470, 0xf01e, 0x7227, 0x9649,
+			0x80a7, 0x64c9, 0xe6f0, 0x029e, 0x4c09, 0xa867, 0x2a5e, 0xce30,
+			0xb770, 0x531e, 0xd127, 0x3549, 0x7bde, 0x9fb0, 0x1d89, 0xf9e7,
+		},
+		{
+			0x0000, 0x87fb, 0xa17d, 0x2686, 0xec71, 0x6b8a, 0x4d0c, 0xcaf7,
+			0x7669, 0xf192, 0xd714, 0x50ef, 0x9a18, 0x1de3, 0x3b65, 0xbc9e,
+			0xecd2, 0x6b29, 0x4daf, 0xca54, 0x00a3, 0x8758, 0xa1de, 0x2625,
+			0x9abb, 0x1d40, 0x3bc6, 0xbc3d, 0x76ca, 0xf131, 0xd7b7, 0x504c,
+			0x772f, 0xf0d4, 0xd652, 0x51a9, 0x9b5e, 0x1ca5, 0x3a23, 0xbdd8,
+			0x0146, 0x86bd, 0xa03b, 0x27c0, 0xed37, 0x6acc, 0x4c4a, 0xcbb1,
+			0x9bfd, 0x1c06, 0x3a80, 0xbd7b, 0x778c, 0xf077, 0xd6f1, 0x510a,
+			0xed94, 0x6a6f, 0x4ce9, 0xcb12, 0x01e5, 0x861e, 0xa098, 0x2763,
+			0xee5e, 0x69a5, 0x4f23, 0xc8d8, 0x022f, 0x85d4, 0xa352, 0x24a9,
+			0x9837, 0x1fcc, 0x394a, 0xbeb1, 0x7446, 0xf3bd, 0xd53b, 0x52c0,
+			0x028c, 0x8577, 0xa3f1, 0x240a, 0xeefd, 0x6906, 0x4f80, 0xc87b,
+			0x74e5, 0xf31e, 0xd598, 0x5263, 0x9894, 0x1f6f, 0x39e9, 0xbe12,
+			0x9971, 0x1e8a, 0x380c, 0xbff7, 0x7500, 0xf2fb, 0xd47d, 0x5386,
+			0xef18, 0x68e3, 0x4e65, 0xc99e, 0x0369, 0x8492, 0xa214, 0x25ef,
+			0x75a3, 0xf258, 0xd4de, 0x5325, 0x99d2, 0x1e29, 0x38af, 0xbf54,
+			0x03ca, 0x8431, 0xa2b7, 0x254c, 0xefbb, 0x6840, 0x4ec6, 0xc93d,
+			0x7237, 0xf5cc, 0xd34a, 0x54b1, 0x9e46, 0x19bd, 0x3f3b, 0xb8c0,
+			0x045e, 0x83a5, 0xa523, 0x22d8, 0xe82f, 0x6fd4, 0x4952, 0xcea9,
+			0x9ee5, 0x191e, 0x3f98, 0xb863, 0x7294, 0xf56f, 0xd3e9, 0x5412,
+			0xe88c, 0x6f77, 0x49f1, 0xce0a, 0x04fd, 0x8306, 0xa580, 0x227b,
+			0x0518, 0x82e3, 0xa465, 0x239e, 0xe969, 0x6e92, 0x4814, 0xcfef,
+			0x7371, 0xf48a, 0xd20c, 0x55f7, 0x9f00, 0x18fb, 0x3e7d, 0xb986,
+			0xe9ca, 0x6e31, 0x48b7, 0xcf4c, 0x05bb, 0x8240, 0xa4c6, 0x233d,
+			0x9fa3, 0x1858, 0x3ede, 0xb925, 0x73d2, 0xf429, 0xd2af, 0x5554,
+			0x9c69, 0x1b92, 0x3d14, 0xbaef, 0x7018, 0xf7e3, 0xd165, 0x569e,
+			0xea00, 0x6dfb, 0x4b7d, 0xcc86, 0x0671, 0x818a, 0xa70c, 0x20f7,
+			0x70bb, 0xf740, 0xd1c6, 0x563d, 0x9cca, 0x1b31, 0x3db7, 0xba4c,
+			0x06d2, 0x8129, 0xa7af, 0x2054, 0xeaa3, 0x6d58, 0x4bde, 0xcc25,
+			0xeb46, 0x6cbd, 0x4a3b, 0xcdc0, 0x0737, 0x80cc, 0xa64a, 0x21b1,
+			0x9d2f, 0x1ad4, 0x3c52, 0xbba9, 0x715e, 0xf6a5, 0xd023, 0x57d8,
+			0x0794, 0x806f, 0xa6e9, 0x2112, 0xebe5, 0x6c1e, 0x4a98, 0xcd63,
+			0x71fd, 0xf606, 0xd080, 0x577b, 0x9d8c, 0x1a77, 0x3cf1, 0xbb0a,
+		},
+		{
+			0x0000, 0x7063, 0xe0c6, 0x90a5, 0x6f07, 0x1f64, 0x8fc1, 0xffa2,
+			0xde0e, 0xae6d, 0x3ec8, 0x4eab, 0xb109, 0xc16a, 0x51cf, 0x21ac,
+			0x1297, 0x62f4, 0xf251, 0x8232, 0x7d90, 0x0df3, 0x9d56, 0xed35,
+			0xcc99, 0xbcfa, 0x2c5f, 0x5c3c, 0xa39e, 0xd3fd, 0x4358, 0x333b,
+			0x252e, 0x554d, 0xc5e8, 0xb58b, 0x4a29, 0x3a4a, 0xaaef, 0xda8c,
+			0xfb20, 0x8b43, 0x1be6, 0x6b85, 0x9427, 0xe444, 0x74e1, 0x0482,
+			0x37b9, 0x47da, 0xd77f, 0xa71c, 0x58be, 0x28dd, 0xb878, 0xc81b,
+			0xe9b7, 0x99d4, 0x0971, 0x7912, 0x86b0, 0xf6d3, 0x6676, 0x1615,
+			0x4a5c, 0x3a3f, 0xaa9a, 0xdaf9, 0x255b, 0x5538, 0xc59d, 0xb5fe,
+			0x9452, 0xe431, 0x7494, 0x04f7, 0xfb55, 0x8b36, 0x1b93, 0x6bf0,
+			0x58cb, 0x28a8, 0xb80d, 0xc86e, 0x37cc, 0x47af, 0xd70a, 0xa769,
+			0x86c5, 0xf6a6, 0x6603, 0x1660, 0xe9c2, 0x99a1, 0x0904, 0x7967,
+			0x6f72, 0x1f11, 0x8fb4, 0xffd7, 0x0075, 0x7016, 0xe0b3, 0x90d0,
+			0xb17c, 0xc11f, 0x51ba, 0x21d9, 0xde7b, 0xae18, 0x3ebd, 0x4ede,
+			0x7de5, 0x0d86, 0x9d23, 0xed40, 0x12e2, 0x6281, 0xf224, 0x8247,
+			0xa3eb, 0xd388, 0x432d, 0x334e, 0xccec, 0xbc8f, 0x2c2a, 0x5c49,
+			0x94b8, 0xe4db, 0x747e, 0x041d, 0xfbbf, 0x8bdc, 0x1b79, 0x6b1a,
+			0x4ab6, 0x3ad5, 0xaa70, 0xda13, 0x25b1, 0x55d2, 0xc577, 0xb514,
+			0x862f, 0xf64c, 0x66e9, 0x168a, 0xe928, 0x994b, 0x09ee, 0x798d,
+			0x5821, 0x2842, 0xb8e7, 0xc884, 0x3726, 0x4745, 0xd7e0, 0xa783,
+			0xb196, 0xc1f5, 0x5150, 0x2133, 0xde91, 0xaef2, 0x3e57, 0x4e34,
+			0x6f98, 0x1ffb, 0x8f5e, 0xff3d, 0x009f, 0x70fc, 0xe059, 0x903a,
+			0xa301, 0xd362, 0x43c7, 0x33a4, 0xcc06, 0xbc65, 0x2cc0, 0x5ca3,
+			0x7d0f, 0x0d6c, 0x9dc9, 0xedaa, 0x1208, 0x626b, 0xf2ce, 0x82ad,
+			0xdee4, 0xae87, 0x3e22, 0x4e41, 0xb1e3, 0xc180, 0x5125, 0x2146,
+			0x00ea, 0x7089, 0xe02c, 0x904f, 0x6fed, 0x1f8e, 0x8f2b, 0xff48,
+			0xcc73, 0xbc10, 0x2cb5, 0x5cd6, 0xa374, 0xd317, 0x43b2, 0x33d1,
+			0x127d, 0x621e, 0xf2bb, 0x82d8, 0x7d7a, 0x0d19, 0x9dbc, 0xeddf,
+			0xfbca, 0x8ba9, 0x1b0c, 0x6b6f, 0x94cd, 0xe4ae, 0x740b, 0x0468,
+			0x25c4, 0x55a7, 0xc502, 0xb561, 0x4ac3, 0x3aa0, 0xaa05, 0xda66,
+			0xe95d, 0x993e, 0x099b, 0x79f8, 0x865a, 0xf639, 0x669c, 0x16ff,
+			0x3753, 0x4730, 0xd795, 0xa7f6, 0x5854, 0x2837, 0xb892, 0xc8f1,
+		},
+		{
+			0x0000, 0x1642, 0x2c84, 0x3ac6, 0x5908, 0x4f4a, 0x758c, 0x63ce,
+			0xb210, 0xa452, 0x9e94, 0x88d6, 0xeb18, 0xfd5a, 0xc79c, 0xd1de,
+			0xcaab, 0xdce9, 0xe62f, 0xf06d, 0x93a3, 0x85e1, 0xbf27, 0xa965,
+			0x78bb, 0x6ef9, 0x543f, 0x427d, 0x21b3, 0x37f1, 0x0d37, 0x1b75,
+			0x3bdd, 0x2d9f, 0x1759, 0x011b, 0x62d5, 0x7497, 0x4e51, 0x5813,
+			0x89cd, 0x9f8f, 0xa549, 0xb30b, 0xd0c5, 0xc687, 0xfc41, 0xea03,
+			0xf176, 0xe734, 0xddf2, 0xcbb0, 0xa87e, 0xbe3c, 0x84fa, 0x92b8,
+			0x4366, 0x5524, 0x6fe2, 0x79a0, 0x1a6e, 0x0c2c, 0x36ea, 0x20a8,
+			0x77ba, 0x61f8, 0x5b3e, 0x4d7c, 0x2eb2, 0x38f0, 0x0236, 0x1474,
+			0xc5aa, 0xd3e8, 0xe92e, 0xff6c, 0x9ca2, 0x8ae0, 0xb026, 0xa664,
+			0xbd11, 0xab53, 0x9195, 0x87d7, 0xe419, 0xf25b, 0xc89d, 0xdedf,
+			0x0f01, 0x1943, 0x2385, 0x35c7, 0x5609, 0x404b, 0x7a8d, 0x6ccf,
+			0x4c67, 0x5a25, 0x60e3, 0x76a1, 0x156f, 0x032d, 0x39eb, 0x2fa9,
+			0xfe77, 0xe835, 0xd2f3, 0xc4b1, 0xa77f, 0xb13d, 0x8bfb, 0x9db9,
+			0x86cc, 0x908e, 0xaa48, 0xbc0a, 0xdfc4, 0xc986, 0xf340, 0xe502,
+			0x34dc, 0x229e, 0x1858, 0x0e1a, 0x6dd4, 0x7b96, 0x4150, 0x5712,
+			0xef74, 0xf936, 0xc3f0, 0xd5b2, 0xb67c, 0xa03e, 0x9af8, 0x8cba,
+			0x5d64, 0x4b26, 0x71e0, 0x67a2, 0x046c, 0x122e, 0x28e8, 0x3eaa,
+			0x25df, 0x339d, 0x095b, 0x1f19, 0x7cd7, 0x6a95, 0x5053, 0x4611,
+			0x97cf, 0x818d, 0xbb4b, 0xad09, 0xcec7, 0xd885, 0xe243, 0xf401,
+			0xd4a9, 0xc2eb, 0xf82d, 0xee6f, 0x8da1, 0x9be3, 0xa125, 0xb767,
+			0x66b9, 0x70fb, 0x4a3d, 0x5c7f, 0x3fb1, 0x29f3, 0x1335, 0x0577,
+			0x1e02, 0x0840, 0x3286, 0x24c4, 0x470a, 0x5148, 0x6b8e, 0x7dcc,
+			0xac12, 0xba50, 0x8096, 0x96d4, 0xf51a, 0xe358, 0xd99e, 0xcfdc,
+			0x98ce, 0x8e8c, 0xb44a, 0xa208, 0xc1c6, 0xd784, 0xed42, 0xfb00,
+			0x2ade, 0x3c9c, 0x065a, 0x1018, 0x73d6, 0x6594, 0x5f52, 0x4910,
+			0x5265, 0x4427, 0x7ee1, 0x68a3, 0x0b6d, 0x1d2f, 0x27e9, 0x31ab,
+			0xe075, 0xf637, 0xccf1, 0xdab3, 0xb97d, 0xaf3f, 0x95f9, 0x83bb,
+			0xa313, 0xb551, 0x8f97, 0x99d5, 0xfa1b, 0xec59, 0xd69f, 0xc0dd,
+			0x1103, 0x0741, 0x3d87, 0x2bc5, 0x480b, 0x5e49, 0x648f, 0x72cd,
+			0x69b8, 0x7ffa, 0x453c, 0x537e, 0x30b0, 0x26f2, 0x1c34, 0x0a76,
+			0xdba8, 0xcdea, 0xf72c, 0xe16e, 0x82a0, 0x94e2, 0xae24, 0xb866,
+		},
+		{
+			0x0000, 0x81b3, 0xaded, 0x2c5e, 0xf551, 0x74e2, 0x58bc, 0xd90f,
+			0x4429, 0xc59a, 0xe9c4, 0x6877, 0xb178, 0x30cb, 0x1c95, 0x9d26,
+			0x8852, 0x09e1, 0x25bf, 0xa40c, 0x7d03, 0xfcb0, 0xd0ee, 0x515d,
+			0xcc7b, 0x4dc8, 0x6196, 0xe025, 0x392a, 0xb899, 0x94c7, 0x1574,
+			0xbe2f, 0x3f9c, 0x13c2, 0x9271, 0x4b7e, 0xcacd, 0xe693, 0x6720,
+			0xfa06, 0x7bb5, 0x57eb, 0xd658, 0x0f57, 0x8ee4, 0xa2ba, 0x2309,
+			0x367d, 0xb7ce, 0x9b90, 0x1a23, 0xc32c, 0x429f, 0x6ec1, 0xef72,
+			0x7254, 0xf3e7, 0xdfb9, 0x5e0a, 0x8705, 0x06b6, 0x2ae8, 0xab5b,
+			0xd2d5, 0x5366, 0x7f38, 0xfe8b, 0x2784, 0xa637, 0x8a69, 0x0bda,
+			0x96fc, 0x174f, 0x3b11, 0xbaa2, 0x63ad, 0xe21e, 0xce40, 0x4ff3,
+			0x5a87, 0xdb34, 0xf76a, 0x76d9, 0xafd6, 0x2e65, 0x023b, 0x8388,
+			0x1eae, 0x9f1d, 0xb343, 0x32f0, 0xebff, 0x6a4c, 0x4612, 0xc7a1,
+			0x6cfa, 0xed49, 0xc117, 0x40a4, 0x99ab, 0x1818, 0x3446, 0xb5f5,
+			0x28d3, 0xa960, 0x853e, 0x048d, 0xdd82, 0x5c31, 0x706f, 0xf1dc,
+			0xe4a8, 0x651b, 0x4945, 0xc8f6, 0x11f9, 0x904a, 0xbc14, 0x3da7,
+			0xa081, 0x2132, 0x0d6c, 0x8cdf, 0x55d0, 0xd463, 0xf83d, 0x798e,
+			0x0b21, 0x8a92, 0xa6cc, 0x277f, 0xfe70, 0x7fc3, 0x539d, 0xd22e,
+			0x4f08, 0xcebb, 0xe2e5, 0x6356, 0xba59, 0x3bea, 0x17b4, 0x9607,
+			0x8373, 0x02c0, 0x2e9e, 0xaf2d, 0x7622, 0xf791, 0xdbcf, 0x5a7c,
+			0xc75a, 0x46e9, 0x6ab7, 0xeb04, 0x320b, 0xb3b8, 0x9fe6, 0x1e55,
+			0xb50e, 0x34bd, 0x18e3, 0x9950, 0x405f, 0xc1ec, 0xedb2, 0x6c01,
+			0xf127, 0x7094, 0x5cca, 0xdd79, 0x0476, 0x85c5, 0xa99b, 0x2828,
+			0x3d5c, 0xbcef, 0x90b1, 0x1102, 0xc80d, 0x49be, 0x65e0, 0xe453,
+			0x7975, 0xf8c6, 0xd498, 0x552b, 0x8c24, 0x0d97, 0x21c9, 0xa07a,
+			0xd9f4, 0x5847, 0x7419, 0xf5aa, 0x2ca5, 0xad16, 0x8148, 0x00fb,
+			0x9ddd, 0x1c6e, 0x3030, 0xb183, 0x688c, 0xe93f, 0xc561, 0x44d2,
+			0x51a6, 0xd015, 0xfc4b, 0x7df8, 0xa4f7, 0x2544, 0x091a, 0x88a9,
+			0x158f, 0x943c, 0xb862, 0x39d1, 0xe0de, 0x616d, 0x4d33, 0xcc80,
+			0x67db, 0xe668, 0xca36, 0x4b85, 0x928a, 0x1339, 0x3f67, 0xbed4,
+			0x23f2, 0xa241, 0x8e1f, 0x0fac, 0xd6a3, 0x5710, 0x7b4e, 0xfafd,
+			0xef89, 0x6e3a, 0x4264, 0xc3d7, 0x1ad8, 0x9b6b, 0xb735, 0x3686,
+			0xaba0, 0x2a13, 0x064d, 0x87fe, 0x5ef1, 0xdf42, 0xf31c, 0x72af,
+		},
+		{
+			0x0000, 0x398a, 0x7314, 0x4a9e, 0xe628, 0xdfa2, 0x953c, 0xacb6,
+			0x62db, 0x5b51, 0x11cf, 0x2845, 0x84f3, 0xbd79, 0xf7e7, 0xce6d,
+			0xc5b6, 0xfc3c, 0xb6a2, 0x8f28, 0x239e, 0x1a14, 0x508a, 0x6900,
+			0xa76d, 0x9ee7, 0xd479, 0xedf3, 0x4145, 0x78cf, 0x3251, 0x0bdb,
+			0x25e7, 0x1c6d, 0x56f3, 0x6f79, 0xc3cf, 0xfa45, 0xb0db, 0x8951,
+			0x473c, 0x7eb6, 0x3428, 0x0da2, 0xa114, 0x989e, 0xd200, 0xeb8a,
+			0xe051, 0xd9db, 0x9345, 0xaacf, 0x0679, 0x3ff3, 0x756d, 0x4ce7,
+			0x828a, 0xbb00, 0xf19e, 0xc814, 0x64a2, 0x5d28, 0x17b6, 0x2e3c,
+			0x4bce, 0x7244, 0x38da, 0x0150, 0xade6, 0x946c, 0xdef2, 0xe778,
+			0x2915, 0x109f, 0x5a01, 0x638b, 0xcf3d, 0xf6b7, 0xbc29, 0x85a3,
+			0x8e78, 0xb7f2, 0xfd6c, 0xc4e6, 0x6850, 0x51da, 0x1b44, 0x22ce,
+			0xeca3, 0xd529, 0x9fb7, 0xa63d, 0x0a8b, 0x3301, 0x799f, 0x4015,
+			0x6e29, 0x57a3, 0x1d3d, 0x24b7, 0x8801, 0xb18b, 0xfb15, 0xc29f,
+			0x0cf2, 0x3578, 0x7fe6, 0x466c, 0xeada, 0xd350, 0x99ce, 0xa044,
+			0xab9f, 0x9215, 0xd88b, 0xe101, 0x4db7, 0x743d, 0x3ea3, 0x0729,
+			0xc944, 0xf0ce, 0xba50, 0x83da, 0x2f6c, 0x16e6, 0x5c78, 0x65f2,
+			0x979c, 0xae16, 0xe488, 0xdd02, 0x71b4, 0x483e, 0x02a0, 0x3b2a,
+			0xf547, 0xcccd, 0x8653, 0xbfd9, 0x136f, 0x2ae5, 0x607b, 0x59f1,
+			0x522a, 0x6ba0, 0x213e, 0x18b4, 0xb402, 0x8d88, 0xc716, 0xfe9c,
+			0x30f1, 0x097b, 0x43e5, 0x7a6f, 0xd6d9, 0xef53, 0xa5cd, 0x9c47,
+			0xb27b, 0x8bf1, 0xc16f, 0xf8e5, 0x5453, 0x6dd9, 0x2747, 0x1ecd,
+			0xd0a0, 0xe92a, 0xa3b4, 0x9a3e, 0x3688, 0x0f02, 0x459c, 0x7c16,
+			0x77cd, 0x4e47, 0x04d9, 0x3d53, 0x91e5, 0xa86f, 0xe2f1, 0xdb7b,
+			0x1516, 0x2c9c, 0x6602, 0x5f88, 0xf33e, 0xcab4, 0x802a, 0xb9a0,
+			0xdc52, 0xe5d8, 0xaf46, 0x96cc, 0x3a7a, 0x03f0, 0x496e, 0x70e4,
+			0xbe89, 0x8703, 0xcd9d, 0xf417, 0x58a1, 0x612b, 0x2bb5, 0x123f,
+			0x19e4, 0x206e, 0x6af0, 0x537a, 0xffcc, 0xc646, 0x8cd8, 0xb552,
+			0x7b3f, 0x42b5, 0x082b, 0x31a1, 0x9d17, 0xa49d, 0xee03, 0xd789,
+			0xf9b5, 0xc03f, 0x8aa1, 0xb32b, 0x1f9d, 0x2617, 0x6c89, 0x5503,
+			0x9b6e, 0xa2e4, 0xe87a, 0xd1f0, 0x7d46, 0x44cc, 0x0e52, 0x37d8,
+			0x3c03, 0x0589, 0x4f17, 0x769d, 0xda2b, 0xe3a1, 0xa93f, 0x90b5,
+			0x5ed8, 0x6752, 0x2dcc, 0x1446, 0xb8f0, 0x817a, 0xcbe4, 0xf26e,
+		},
+	};
+} // namespace crc_generated_tables
+const crc::sliced_table<crc::tbl_cfg<16, 0xa2eb, true>, 8> crc::static_table<crc::sliced_table<crc::tbl_cfg<16, 0xa2eb, true>, 8>>::instance(crc_generated_tables::table_2);
+
+#endif // PARAMETRIC_CRC_DEFINE_TABLES
@@ -0,0 +1,10 @@
+// SPDX-License-Identifier: MIT-0
+// SPDX-FileCopyrightText:  2024 Istvan Pasztor
+//
+// Runs test.cpp with PARAMETRIC_CRC_THREADS: parallel_calculate() on
+// std::threads and crc::pipeline are tested too, for example:
+//    g++ -std=c++14 -O2 -pthread test_threads.cpp -o test_threads
+//    cl /O2 /EHsc test_threads.cpp
+
+#define PARAMETRIC_CRC_THREADS
+#include "test.cpp"